@@ -0,0 +1,8 @@
+#include "ofMain.h"
+#include "ofApp.h"
+
+int main()
+{
+    ofSetupOpenGL(1280, 800, OF_WINDOW);
+    ofRunApp(new ofApp());
+}
@@ -0,0 +1,147 @@
+#include "ofApp.h"
+
+void ofApp::setup()
+{
+    ofSetFrameRate(0);
+    ofSetVerticalSync(false);
+    ofSetWindowTitle("ofxDatGui benchmark");
+
+    mMode = BATCH_MESH;
+    mBatchRendering = true;
+    mLabelMicros = 0;
+    mFrameMillis = 0;
+    mDrawCalls = 0;
+    mTextureBinds = 0;
+
+// a grid of labels similar to what a few large panels draw //
+    mFont = ofxSmartFont::add("ofxbraitsch/fonts/Verdana.ttf", 6, "benchmark");
+    for (int i=0; i<NUM_LABELS; i++){
+        mStrings.push_back("label " + ofToString(i));
+        mMeshes.push_back(mFont->mesh(mStrings.back()));
+        mPositions.push_back(ofPoint(20 + (i % 10) * 60, 140 + (i / 10) * 3));
+    }
+
+// panels exercise the quad batch & the compositor alongside the labels //
+    for (int i=0; i<NUM_GUIS; i++){
+        ofxDatGui* gui = new ofxDatGui(660 + (i % 2) * 310, 20 + (i / 2) * 390);
+        gui->addHeader("panel " + ofToString(i + 1));
+        for (int j=0; j<8; j++) gui->addSlider("slider " + ofToString(j + 1), 0, 100, j * 10);
+        for (int j=0; j<4; j++) gui->addToggle("toggle " + ofToString(j + 1), j % 2 == 0);
+        gui->addColorPicker("color", ofColor::fromHsb(i * 60, 200, 200));
+        gui->setBatchRendering(mBatchRendering);
+        gui->setAutoDraw(true);
+        mGuis.push_back(gui);
+    }
+    benchmarkFormatting();
+}
+
+void ofApp::update()
+{
+// the panels are drawn after the app so the counters hold the whole previous frame //
+    mDrawCalls = ofxDatGuiBatch::getDrawCalls();
+    mTextureBinds = ofxSmartFont::getTextureBinds();
+    ofxDatGuiBatch::resetDrawCalls();
+    ofxSmartFont::resetTextureBinds();
+    mFrameMillis = ofLerp(mFrameMillis, ofGetLastFrameTime() * 1000.0f, 0.05f);
+}
+
+void ofApp::draw()
+{
+    ofBackground(40);
+// wait for the gpu on both sides so the timing covers submitting & drawing the labels //
+    glFinish();
+    uint64_t start = ofGetElapsedTimeMicros();
+    drawLabels();
+    glFinish();
+    mLabelMicros = ofLerp(mLabelMicros, ofGetElapsedTimeMicros() - start, 0.05f);
+    drawReport();
+}
+
+void ofApp::drawLabels()
+{
+    ofSetColor(ofColor::white);
+    if (mMode == DRAW_STRING){
+        for (int i=0; i<NUM_LABELS; i++) mFont->draw(mStrings[i], mPositions[i].x, mPositions[i].y);
+    }   else if (mMode == BATCH_STRING){
+        ofxSmartFont::begin();
+        for (int i=0; i<NUM_LABELS; i++) mFont->add(mStrings[i], mPositions[i].x, mPositions[i].y, ofColor::white);
+        ofxSmartFont::end();
+    }   else{
+        ofxSmartFont::begin();
+        for (int i=0; i<NUM_LABELS; i++) mFont->add(mMeshes[i], mPositions[i].x, mPositions[i].y, ofColor::white);
+        ofxSmartFont::end();
+    }
+}
+
+void ofApp::drawReport()
+{
+    string modes[] = {"", "drawString per label", "batched strings", "batched glyph meshes"};
+    float labelsPerMs = mLabelMicros > 0 ? NUM_LABELS / (mLabelMicros / 1000.0f) : 0;
+    stringstream ss;
+    ss << "[1,2,3] text path     : " << modes[mMode] << endl;
+    ss << "[b] batch rendering   : " << (mBatchRendering ? "on" : "off") << endl;
+    ss << "[a] shared atlas      : " << (ofxSmartFont::getSharedAtlas() ? "on" : "off") << endl;
+    ss << "labels per ms         : " << ofToString(labelsPerMs, 1) << " (" << NUM_LABELS << " labels in " << ofToString(mLabelMicros / 1000.0f, 2) << " ms)" << endl;
+    ss << "draw calls            : " << mDrawCalls << endl;
+    ss << "text texture binds    : " << mTextureBinds << endl;
+    ss << "frame time            : " << ofToString(mFrameMillis, 2) << " ms (" << ofToString(ofGetFrameRate(), 0) << " fps)" << endl;
+    ss << "[f] values per second : " << ofToString(mFormatStrings / 1e6, 2) << "M with ofToString, " << ofToString(mFormatFixed / 1e6, 2) << "M with ofxDatGuiFormat";
+    ofDrawBitmapStringHighlight(ss.str(), 20, 20);
+}
+
+/*
+    formats the same values the way sliders used to, through ofToString & string appends,
+    and through ofxDatGuiFormat::fixed into a reused buffer
+*/
+
+void ofApp::benchmarkFormatting()
+{
+    int precision = 2;
+    vector<double> values(NUM_VALUES);
+    for (int i=0; i<NUM_VALUES; i++) values[i] = ofRandom(-1000, 1000);
+// sum the lengths so the compiler can't drop the work //
+    size_t chars = 0;
+    uint64_t start = ofGetElapsedTimeMicros();
+    for (int i=0; i<NUM_VALUES; i++){
+        double r = roundf(values[i] * pow(10, precision)) / pow(10, precision);
+        string v = ofToString(r);
+        int p = v.find('.');
+        if (p == -1){
+            v += '.';
+            p = v.find('.');
+        }
+        while(v.length() - p < (precision + 1)) v += '0';
+        chars += v.length();
+    }
+    mFormatStrings = NUM_VALUES / ((ofGetElapsedTimeMicros() - start) / 1e6);
+    char buffer[ofxDatGuiFormat::BUFFER_SIZE];
+    start = ofGetElapsedTimeMicros();
+    for (int i=0; i<NUM_VALUES; i++) chars += ofxDatGuiFormat::fixed(buffer, values[i], precision, true);
+    mFormatFixed = NUM_VALUES / ((ofGetElapsedTimeMicros() - start) / 1e6);
+// values too large for the integer path must still report exactly what fits in the buffer //
+    for (double v : {double(FLT_MAX), double(-FLT_MAX), 1e26, 1e300}){
+        int n = ofxDatGuiFormat::fixed(buffer, v, ofxDatGuiFormat::MAX_PRECISION, true);
+        if (n != strlen(buffer) || n >= ofxDatGuiFormat::BUFFER_SIZE){
+            ofLogError("benchmark") << "formatting " << v << " reported " << n << " chars but wrote " << strlen(buffer);
+        }
+    }
+    ofLogNotice("benchmark") << "formatted " << chars << " chars, " << mFormatStrings << " values/s with ofToString, " << mFormatFixed << " values/s with ofxDatGuiFormat";
+}
+
+void ofApp::keyPressed(int key)
+{
+    if (key == '1'){
+        mMode = DRAW_STRING;
+    }   else if (key == '2'){
+        mMode = BATCH_STRING;
+    }   else if (key == '3'){
+        mMode = BATCH_MESH;
+    }   else if (key == 'b'){
+        mBatchRendering = !mBatchRendering;
+        for (auto gui:mGuis) gui->setBatchRendering(mBatchRendering);
+    }   else if (key == 'a'){
+        ofxSmartFont::setSharedAtlas(!ofxSmartFont::getSharedAtlas());
+    }   else if (key == 'f'){
+        benchmarkFormatting();
+    }
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "ofMain.h"
+#include "ofxDatGui.h"
+
+/*
+    draws a grid of labels with each of ofxSmartFont's text paths and a few gui panels,
+    then reports labels per millisecond, draw calls, texture binds & frame time.
+    copy the ofxbraitsch folder into bin/data before running.
+
+    1 : one drawString per label, the path labels used before text batching
+    2 : labels added to a batch as strings & laid out every frame
+    3 : labels added to a batch from cached glyph meshes, the path components use
+    b : toggle batch rendering on the panels
+    a : toggle the shared font atlas
+    f : rerun the slider value formatting microbenchmark
+*/
+
+class ofApp : public ofBaseApp{
+
+    public:
+
+        void setup();
+        void update();
+        void draw();
+        void keyPressed(int key);
+
+    private:
+
+        enum Mode {
+            DRAW_STRING = 1,
+            BATCH_STRING,
+            BATCH_MESH
+        };
+
+        void drawLabels();
+        void drawReport();
+        void benchmarkFormatting();
+
+        Mode mMode;
+        bool mBatchRendering;
+        shared_ptr<ofxSmartFont> mFont;
+        vector<string> mStrings;
+        vector<ofMesh> mMeshes;
+        vector<ofPoint> mPositions;
+        vector<ofxDatGui*> mGuis;
+
+    // running averages so the numbers are readable //
+        float mLabelMicros;
+        float mFrameMillis;
+        int mDrawCalls;
+        int mTextureBinds;
+    // slider values formatted per second with ofToString & with ofxDatGuiFormat //
+        double mFormatStrings;
+        double mFormatFixed;
+
+        static const int NUM_LABELS = 2000;
+        static const int NUM_GUIS = 4;
+        static const int NUM_VALUES = 1000000;
+
+};
@@ -110,14 +110,10 @@ class ofxDatGui2dPad : public ofxDatGuiComponent {
                 mLocal.x = mPad.x + mPad.width * mPercentX;
                 mLocal.y = mPad.y + mPad.height * mPercentY;
                 ofxDatGuiComponent::draw();
-                ofSetColor(mColors.fill);
-                ofDrawRectangle(mPad);
-                ofSetLineWidth(mLineWeight);
-                ofSetColor(mColors.line);
-                ofDrawLine(mPad.x, mLocal.y, mPad.x + mPad.width, mLocal.y);
-                ofDrawLine(mLocal.x, mPad.y, mLocal.x, mPad.y + mPad.height);
-                ofSetColor(mColors.ball);
-                ofDrawCircle(mLocal, mBallSize);
+                ofxDatGuiBatch::rect(mPad, mColors.fill);
+                ofxDatGuiRenderer::getRenderer()->line(mPad.x, mLocal.y, mPad.x + mPad.width, mLocal.y, mColors.line, mLineWeight);
+                ofxDatGuiRenderer::getRenderer()->line(mLocal.x, mPad.y, mLocal.x, mPad.y + mPad.height, mColors.line, mLineWeight);
+                ofxDatGuiRenderer::getRenderer()->circle(mLocal.x, mLocal.y, mBallSize, mColors.ball);
             ofPopStyle();
         }
     
@@ -127,6 +123,7 @@ class ofxDatGui2dPad : public ofxDatGuiComponent {
     
         void setWorldCoordinates()
         {
+            mDirty = true;
             mWorld.x = mBounds.x + (mBounds.width * mPercentX);
             mWorld.y = mBounds.y + (mBounds.height * mPercentY);
         }
@@ -54,17 +54,17 @@ class ofxDatGuiButton : public ofxDatGuiComponent {
             // anything that extends ofxDatGuiButton has the same rollover effect //
                 ofPushStyle();
                     if (mStyle.border.visible) drawBorder();
-                    ofFill();
+                    ofColor bkgd;
                     if (mFocused && mMouseDown){
-                        ofSetColor(mStyle.color.onMouseDown, mStyle.opacity);
+                        bkgd = mStyle.color.onMouseDown;
                     }   else if (mMouseOver){
-                        ofSetColor(mStyle.color.onMouseOver, mStyle.opacity);
+                        bkgd = mStyle.color.onMouseOver;
                     }   else{
-                        ofSetColor(mStyle.color.background, mStyle.opacity);
+                        bkgd = mStyle.color.background;
                     }
-                    ofDrawRectangle(x, y, mStyle.width, mStyle.height);
-                    drawLabel();
+                    ofxDatGuiBatch::rect(x, y, mStyle.width, mStyle.height, ofColor(bkgd, mStyle.opacity));
                     if (mStyle.stripe.visible) drawStripe();
+                    drawLabel();
                 ofPopStyle();
             }
         }
@@ -119,10 +119,12 @@ class ofxDatGuiToggle : public ofxDatGuiButton {
         void toggle()
         {
             mChecked = !mChecked;
+            mDirty = true;
         }
     
         void setChecked(bool check)
         {
+            if (check != mChecked) mDirty = true;
             mChecked = check;
         }
     
@@ -136,16 +138,19 @@ class ofxDatGuiToggle : public ofxDatGuiButton {
             if (mVisible) {
                 ofPushStyle();
                 ofxDatGuiButton::draw();
-                ofSetColor(mIcon.color);
-                if (mChecked == true){
-                    radioOn->draw(x+mIcon.x, y+mIcon.y/2, mIcon.size, mIcon.size);
-                }   else{
-                    radioOff->draw(x+mIcon.x, y+mIcon.y/2, mIcon.size, mIcon.size);
-                }
+                ofxDatGuiRenderer::getRenderer()->image(mChecked ? radioOn : radioOff, x+mIcon.x, y+mIcon.y/2, mIcon.size, mIcon.size, mIcon.color);
                 ofPopStyle();
             }
         }
     
+    // the toggle's state is shown as a dot //
+        void drawReduced()
+        {
+            if (!mVisible) return;
+            ofxDatGuiComponent::drawReduced();
+            if (mChecked) ofxDatGuiBatch::rect(x+mIcon.x, y+mIcon.y/2, mIcon.size, mIcon.size, mIcon.color);
+        }
+    
         static ofxDatGuiToggle* getInstance() { return new ofxDatGuiToggle("X"); }
     
     protected:
@@ -56,7 +56,7 @@ class ofxDatGuiColorPicker : public ofxDatGuiTextInput {
             gColors.push_back(ofColor::black);  // btm-right
             gColors.push_back(ofColor::black);  // btm-left
             gColors.push_back(ofColor::white);  // top-left
-            vbo.setColorData(&gColors[0], 6, GL_DYNAMIC_DRAW );
+            mGradientInvalid = true;
         }
     
         void setTheme(const ofxDatGuiTheme* theme)
@@ -100,26 +100,8 @@ class ofxDatGuiColorPicker : public ofxDatGuiTextInput {
             ofPushStyle();
                 ofxDatGuiTextInput::draw();
                 if (mShowPicker) {
-                    pickerRect.x = this->x + mLabel.width;
-                    pickerRect.y = this->y + mStyle.padding + mInput.getHeight();
-                    pickerRect.width = mInput.getWidth();
-                    rainbow.rect.x = pickerRect.x + pickerRect.width - rainbow.rect.width - mStyle.padding;
-                    rainbow.rect.y = pickerRect.y + mStyle.padding;
-                    gradientRect.x = pickerRect.x + mStyle.padding;
-                    gradientRect.y = pickerRect.y + mStyle.padding;
-                    gradientRect.width = pickerRect.width - rainbow.rect.width - (mStyle.padding * 3);
-                    gPoints[0] = ofVec2f(gradientRect.x+ gradientRect.width/2, gradientRect.y + gradientRect.height/2);
-                    gPoints[1] = ofVec2f(gradientRect.x, gradientRect.y);
-                    gPoints[2] = ofVec2f(gradientRect.x+ gradientRect.width, gradientRect.y);
-                    gPoints[3] = ofVec2f(gradientRect.x+ gradientRect.width, gradientRect.y + gradientRect.height);
-                    gPoints[4] = ofVec2f(gradientRect.x, gradientRect.y+gradientRect.height);
-                    gPoints[5] = ofVec2f(gradientRect.x, gradientRect.y);
-                    vbo.setVertexData(&gPoints[0], 6, GL_DYNAMIC_DRAW );
-                    ofSetColor(pickerBorder);
-                    ofDrawRectangle(pickerRect);
-                    ofSetColor(ofColor::white);
-                    rainbow.image->draw(rainbow.rect);
-                    vbo.draw( GL_TRIANGLE_FAN, 0, 6 );
+                    layoutPicker();
+                    drawPicker();
                 }
             ofPopStyle();
         }
@@ -128,11 +110,7 @@ class ofxDatGuiColorPicker : public ofxDatGuiTextInput {
         {
             if (mVisible && mShowPicker){
                 ofPushStyle();
-                    ofSetColor(pickerBorder);
-                    ofDrawRectangle(pickerRect);
-                    ofSetColor(ofColor::white);
-                    rainbow.image->draw(rainbow.rect);
-                    vbo.draw( GL_TRIANGLE_FAN, 0, 6 );
+                    drawPicker();
                 ofPopStyle();
             }
         }
@@ -142,16 +120,12 @@ class ofxDatGuiColorPicker : public ofxDatGuiTextInput {
             if (mInput.hitTest(m)){
                 return true;
             }   else if (mShowPicker && pickerRect.inside(m)){
-                unsigned char p[3];
-                int y = (ofGetMouseY()-ofGetHeight())*-1;
-                glReadPixels(ofGetMouseX(), y, 1, 1, GL_RGB, GL_UNSIGNED_BYTE, &p);
-                gColor.r = int(p[0]);
-                gColor.g = int(p[1]);
-                gColor.b = int(p[2]);
+                gColor = getColorAt(m);
                 if (rainbow.rect.inside(m) && mMouseDown){
                     gColors[2] = gColor;
                     gColors[0] = ofColor(gColor.r/2, gColor.g/2, gColor.b/2);
-                    vbo.setColorData(&gColors[0], 6, GL_DYNAMIC_DRAW );
+                    mGradientInvalid = true;
+                    mDirty = true;
                 }   else if (gradientRect.inside(m) && mMouseDown){
                     mColor = gColor;
                 // dispatch event out to main application //
@@ -169,6 +143,35 @@ class ofxDatGuiColorPicker : public ofxDatGuiTextInput {
             }
         }
     
+    /*
+        returns the color drawn under a point of the open picker, computed on the cpu from the
+        rainbow image's pixels & the gradient's triangle fan so picking never reads the framebuffer
+    */
+        ofColor getColorAt(ofPoint m)
+        {
+            layoutPicker();
+            if (rainbow.rect.inside(m)){
+                const ofPixels& pixels = rainbow.image->getPixels();
+                if (pixels.getWidth() == 0 || pixels.getHeight() == 0) return pickerBorder;
+                int px = ofClamp((m.x - rainbow.rect.x) / rainbow.rect.width * pixels.getWidth(), 0, pixels.getWidth() - 1);
+                int py = ofClamp((m.y - rainbow.rect.y) / rainbow.rect.height * pixels.getHeight(), 0, pixels.getHeight() - 1);
+                return pixels.getColor(px, py);
+            }   else if (gradientRect.inside(m)){
+            // find which of the four fan triangles contains the point, fan vertex 0 is the center //
+                float dx = (m.x - gPoints[0].x) / (gradientRect.width / 2);
+                float dy = (m.y - gPoints[0].y) / (gradientRect.height / 2);
+                int a;
+                if (fabs(dy) >= fabs(dx)){
+                    a = dy < 0 ? 1 : 3;
+                }   else{
+                    a = dx > 0 ? 2 : 4;
+                }
+                return interpolate(m, 0, a, a + 1);
+            }   else{
+                return pickerBorder;
+            }
+        }
+    
         static ofxDatGuiColorPicker* getInstance() { return new ofxDatGuiColorPicker("X"); }
     
     protected:
@@ -201,7 +204,8 @@ class ofxDatGuiColorPicker : public ofxDatGuiTextInput {
         // update the gradient picker //
             gColors[2] = mColor;
             gColors[0] = ofColor(mColor.r/2, mColor.g/2, mColor.b/2);
-            vbo.setColorData(&gColors[0], 6, GL_DYNAMIC_DRAW );
+            mGradientInvalid = true;
+            mDirty = true;
         // dispatch event out to main application //
             if (colorPickerEventCallback != nullptr) {
                 ofxDatGuiColorPickerEvent evt(this, mColor);
@@ -220,6 +224,7 @@ class ofxDatGuiColorPicker : public ofxDatGuiTextInput {
             while(res.size() < 6) res+="0";
             mInput.setText(ofToUpper(res));
             updateTextFieldColors();
+            mDirty = true;
         }
     
     private:
@@ -238,9 +243,68 @@ class ofxDatGuiColorPicker : public ofxDatGuiTextInput {
         ofRectangle gradientRect;
     
         ofVbo vbo;
+        bool mGradientInvalid;
         vector<ofVec2f> gPoints;
         vector<ofFloatColor> gColors;
     
+        void drawPicker()
+        {
+            ofxDatGuiBatch::rect(pickerRect, pickerBorder);
+            ofxDatGuiRenderer::getRenderer()->image(rainbow.image, rainbow.rect.x, rainbow.rect.y, rainbow.rect.width, rainbow.rect.height, ofColor::white);
+            ofxDatGuiRenderer::getRenderer()->custom("colorpicker.gradient", gradientRect, [&](){
+            // the vbo is only touched by the renderer so recording the draw path never needs a gl context //
+                if (mGradientInvalid){
+                    vbo.setVertexData(&gPoints[0], 6, GL_DYNAMIC_DRAW );
+                    vbo.setColorData(&gColors[0], 6, GL_DYNAMIC_DRAW );
+                    mGradientInvalid = false;
+                }
+                ofSetColor(ofColor::white);
+                vbo.draw( GL_TRIANGLE_FAN, 0, 6 );
+            });
+        }
+    
+        void layoutPicker()
+        {
+            pickerRect.x = this->x + mLabel.width;
+            pickerRect.y = this->y + mStyle.padding + mInput.getHeight();
+            pickerRect.width = mInput.getWidth();
+            rainbow.rect.x = pickerRect.x + pickerRect.width - rainbow.rect.width - mStyle.padding;
+            rainbow.rect.y = pickerRect.y + mStyle.padding;
+            gradientRect.x = pickerRect.x + mStyle.padding;
+            gradientRect.y = pickerRect.y + mStyle.padding;
+            gradientRect.width = pickerRect.width - rainbow.rect.width - (mStyle.padding * 3);
+        // the fan only needs re-uploading when the picker has moved or resized //
+            ofVec2f center = ofVec2f(gradientRect.x+ gradientRect.width/2, gradientRect.y + gradientRect.height/2);
+            ofVec2f corner = ofVec2f(gradientRect.x+ gradientRect.width, gradientRect.y + gradientRect.height);
+            if (center == gPoints[0] && corner == gPoints[3]) return;
+            mGradientInvalid = true;
+            gPoints[0] = center;
+            gPoints[1] = ofVec2f(gradientRect.x, gradientRect.y);
+            gPoints[2] = ofVec2f(gradientRect.x+ gradientRect.width, gradientRect.y);
+            gPoints[3] = corner;
+            gPoints[4] = ofVec2f(gradientRect.x, gradientRect.y+gradientRect.height);
+            gPoints[5] = ofVec2f(gradientRect.x, gradientRect.y);
+        }
+    
+    // barycentric blend of the fan colors, matching how the gpu shades the triangle //
+        ofColor interpolate(ofPoint m, int a, int b, int c)
+        {
+            ofVec2f v0 = gPoints[b] - gPoints[a];
+            ofVec2f v1 = gPoints[c] - gPoints[a];
+            ofVec2f v2 = ofVec2f(m.x, m.y) - gPoints[a];
+            float d = v0.x * v1.y - v1.x * v0.y;
+            if (d == 0) return gColors[a];
+            float wb = ofClamp((v2.x * v1.y - v1.x * v2.y) / d, 0, 1);
+            float wc = ofClamp((v0.x * v2.y - v2.x * v0.y) / d, 0, 1);
+            float wa = max(0.0f, 1 - wb - wc);
+            const ofFloatColor& ca = gColors[a];
+            const ofFloatColor& cb = gColors[b];
+            const ofFloatColor& cc = gColors[c];
+            return ofColor((ca.r * wa + cb.r * wb + cc.r * wc) * 255,
+                           (ca.g * wa + cb.g * wb + cc.g * wc) * 255,
+                           (ca.b * wa + cb.b * wb + cc.b * wc) * 255);
+        }
+    
         void updateTextFieldColors()
         {
             mInput.setBackgroundColor(mColor);
@@ -39,6 +39,7 @@ class ofxDatGuiFRM : public ofxDatGuiTextInput {
             if (ofGetElapsedTimef() - mTime > mRefresh){
                 mTime = ofGetElapsedTimef();
                 mInput.setText(ofToString(ofGetFrameRate(), 2));
+                mDirty = true;
             }
         }
         
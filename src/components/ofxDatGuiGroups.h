@@ -89,31 +89,43 @@ class ofxDatGuiGroup : public ofxDatGuiButton {
                 ofxDatGuiButton::draw();
                 if (mIsExpanded) {
                     int mHeight = mStyle.height;
-                    ofSetColor(mStyle.guiBackground, mStyle.opacity);
-                    ofDrawRectangle(x, y+mHeight, mStyle.width, mStyle.vMargin);
+                    ofxDatGuiBatch::rect(x, y+mHeight, mStyle.width, mStyle.vMargin, ofColor(mStyle.guiBackground, mStyle.opacity));
                     for(int i=0; i<children.size(); i++) {
                         mHeight += mStyle.vMargin;
                         children[i]->draw();
                         mHeight += children[i]->getHeight();
                         if (i == children.size()-1) break;
-                        ofSetColor(mStyle.guiBackground, mStyle.opacity);
-                        ofDrawRectangle(x, y+mHeight, mStyle.width, mStyle.vMargin);
+                        ofxDatGuiBatch::rect(x, y+mHeight, mStyle.width, mStyle.vMargin, ofColor(mStyle.guiBackground, mStyle.opacity));
                     }
-                    ofSetColor(mIcon.color);
-                    mIconOpen->draw(x+mIcon.x, y+mIcon.y/2, mIcon.size, mIcon.size);
+                    ofxDatGuiRenderer::getRenderer()->image(mIconOpen, x+mIcon.x, y+mIcon.y/2, mIcon.size, mIcon.size, mIcon.color);
                     for(int i=0; i<children.size(); i++) children[i]->drawColorPicker();
                 }   else{
-                    ofSetColor(mIcon.color);
-                    mIconClosed->draw(x+mIcon.x, y+mIcon.y/2, mIcon.size, mIcon.size);
+                    ofxDatGuiRenderer::getRenderer()->image(mIconClosed, x+mIcon.x, y+mIcon.y/2, mIcon.size, mIcon.size, mIcon.color);
                 }
                 ofPopStyle();
             }
         }
     
+        void drawReduced()
+        {
+            if (!mVisible) return;
+            ofxDatGuiComponent::drawReduced();
+            if (mIsExpanded) {
+                int mHeight = mStyle.height;
+                for(int i=0; i<children.size(); i++) {
+                    mHeight += mStyle.vMargin;
+                    ofxDatGuiBatch::rect(x, y+mHeight-mStyle.vMargin, mStyle.width, mStyle.vMargin, ofColor(mStyle.guiBackground, mStyle.opacity));
+                    children[i]->drawReduced();
+                    mHeight += children[i]->getHeight();
+                }
+            }
+        }
+    
     protected:
     
-        void layout()
+        virtual void layout()
         {
+            mDirty = true;
             mHeight = mStyle.height + mStyle.vMargin;
             for (int i=0; i<children.size(); i++) {
                 if (children[i]->getVisible() == false) continue;
@@ -443,18 +455,25 @@ class ofxDatGuiDropdown : public ofxDatGuiGroup {
         ofxDatGuiDropdown(string label, const vector<string>& options = vector<string>()) : ofxDatGuiGroup(label)
         {
             mOption = 0;
+            mLabelWidth = 0;
+            mMaxResults = 12;
+            mSearchable = false;
+            mTheme = nullptr;
             mType = ofxDatGuiType::DROPDOWN;
-            for(int i=0; i<options.size(); i++){
-                ofxDatGuiDropdownOption* opt = new ofxDatGuiDropdownOption(options[i]);
-                opt->setIndex(children.size());
-                opt->onButtonEvent(this, &ofxDatGuiDropdown::onOptionSelected);
-                children.push_back(opt);
-            }
+            indexOptions(options);
+        // options are turned into components the first time they're needed //
+            mStale = true;
             setTheme(ofxDatGuiComponent::getTheme());
         }
     
+        ~ofxDatGuiDropdown()
+        {
+            for (auto i:mSpare) delete i;
+        }
+    
         void setTheme(const ofxDatGuiTheme* theme)
         {
+            mTheme = theme;
             setComponentStyle(theme);
             mIconOpen = theme->icon.groupOpen;
             mIconClosed = theme->icon.groupClosed;
@@ -464,6 +483,7 @@ class ofxDatGuiDropdown : public ofxDatGuiGroup {
     
         void setWidth(int width, float labelWidth = 1)
         {
+            mLabelWidth = labelWidth;
             ofxDatGuiComponent::setWidth(width, labelWidth);
             mLabel.width = mStyle.width;
             mLabel.rightAlignedXpos = mIcon.x - mLabel.margin;
@@ -473,36 +493,114 @@ class ofxDatGuiDropdown : public ofxDatGuiGroup {
         void select(int cIndex)
         {
         // ensure value is in range //
-            if (cIndex < 0 || cIndex >= children.size()){
+            if (cIndex < 0 || cIndex >= mOptions.size()){
                 ofLogError() << "ofxDatGuiDropdown->select("<<cIndex<<") is out of range";
             }   else{
-                setLabel(children[cIndex]->getLabel());
+                setLabel(mOptions[cIndex]);
             }
         }
 
         int size()
         {
-            return children.size();
+            return mOptions.size();
         }
     
+    // returns the index of the first option with this label or -1 //
+        int indexOf(string label)
+        {
+            auto i = mLookup.find(label);
+            return i == mLookup.end() ? -1 : i->second;
+        }
+    
+    // returns the component of an option or nullptr if it is filtered out of a searchable dropdown //
         ofxDatGuiDropdownOption* getChildAt(int index)
         {
-            return static_cast<ofxDatGuiDropdownOption*>(children[index]);
+            if (mStale) build();
+            if (mSearchable == false) return static_cast<ofxDatGuiDropdownOption*>(children[index]);
+            for(auto i:children) if (i->getIndex() == index) return static_cast<ofxDatGuiDropdownOption*>(i);
+            return nullptr;
         }
     
         ofxDatGuiDropdownOption* getSelected()
         {
-            return static_cast<ofxDatGuiDropdownOption*>(children[mOption]);
+            return getChildAt(mOption);
+        }
+    
+    /*
+        searchable dropdowns filter their options as the user types while the dropdown is open,
+        only the first maxResults matches are turned into components
+    */
+    
+        void setSearchable(bool searchable, int maxResults = 12)
+        {
+            mSearchable = searchable;
+            mMaxResults = maxResults;
+            setFilter("");
+        }
+    
+        bool getSearchable()
+        {
+            return mSearchable;
+        }
+    
+        void setFilter(string query)
+        {
+        // a dropdown that isn't searchable always lists every option in order //
+            if (mSearchable == false && query.size() > 0){
+                ofxDatGuiLog::write(ofxDatGuiMsg::DROPDOWN_NOT_SEARCHABLE, "ofxDatGuiDropdown::setFilter");
+                return;
+            }
+            search(query);
+            mStale = true;
+            if (mIsExpanded) build();
+        // dispatch an event out to the gui panel to adjust its children //
+            if (internalEventCallback != nullptr){
+                ofxDatGuiInternalEvent e(ofxDatGuiEventType::DROPDOWN_TOGGLED, mIndex);
+                internalEventCallback(e);
+            }
+        }
+    
+        string getFilter()
+        {
+            return mFilter;
         }
     
         static ofxDatGuiDropdown* getInstance() { return new ofxDatGuiDropdown("X"); }
     
+    protected:
+    
+        void onMouseRelease(ofPoint m)
+        {
+            ofxDatGuiGroup::onMouseRelease(m);
+        // keep focus while open so key presses reach the filter //
+            if (mSearchable && mIsExpanded) onFocus();
+        }
+    
+        void onKeyPressed(int key)
+        {
+            if (mSearchable == false || mIsExpanded == false) return;
+            if (key == OF_KEY_BACKSPACE){
+                if (mFilter.size() > 0) setFilter(mFilter.substr(0, mFilter.size() - 1));
+            }   else if (key >= 32 && key < 127){
+                setFilter(mFilter + char(key));
+            }
+        }
+    
+        void layout()
+        {
+            if (mIsExpanded && mStale){
+                build();
+            }   else{
+                ofxDatGuiGroup::layout();
+            }
+        }
+    
     private:
     
         void onOptionSelected(ofxDatGuiButtonEvent e)
         {
-            for(int i=0; i<children.size(); i++) if (e.target == children[i]) mOption = i;
-            setLabel(children[mOption]->getLabel());
+            mOption = e.target->getIndex();
+            setLabel(mOptions[mOption]);
             collapse();
             if (dropdownEventCallback != nullptr) {
                 ofxDatGuiDropdownEvent e1(this, mIndex, mOption);
@@ -513,7 +611,104 @@ class ofxDatGuiDropdown : public ofxDatGuiGroup {
             }
         }
     
+    /*
+        the index keeps the labels lowercased in option order for substring matches and
+        sorted for prefix matches, plus a label lookup table
+    */
+    
+        void indexOptions(const vector<string>& options)
+        {
+            mOptions = options;
+            mKeys.resize(options.size());
+            mPrefix.resize(options.size());
+            mMatches.resize(options.size());
+            for(int i=0; i<options.size(); i++){
+                mKeys[i] = ofToLower(options[i]);
+                mPrefix[i] = make_pair(mKeys[i], i);
+                mMatches[i] = i;
+                mLookup.emplace(options[i], i);
+            }
+            sort(mPrefix.begin(), mPrefix.end());
+        }
+    
+    // prefix matches are listed first, followed by the remaining substring matches in option order //
+        void search(string query)
+        {
+            string key = ofToLower(query);
+            bool narrowing = mFilter.size() > 0 && key.find(ofToLower(mFilter)) != string::npos;
+            mFilter = query;
+            if (key.size() == 0){
+                mMatches.resize(mOptions.size());
+                for(int i=0; i<mOptions.size(); i++) mMatches[i] = i;
+                return;
+            }
+        // a longer query can only match options that matched the previous one //
+            vector<int> candidates;
+            if (narrowing){
+                candidates.swap(mMatches);
+            }   else{
+                candidates.resize(mOptions.size());
+                for(int i=0; i<mOptions.size(); i++) candidates[i] = i;
+            }
+            mMatches.clear();
+            auto p = lower_bound(mPrefix.begin(), mPrefix.end(), make_pair(key, -1));
+            for(; p != mPrefix.end() && p->first.compare(0, key.size(), key) == 0; ++p) mMatches.push_back(p->second);
+            for(auto i:candidates){
+                size_t pos = mKeys[i].find(key);
+                if (pos != string::npos && pos != 0) mMatches.push_back(i);
+            }
+        }
+    
+        void build()
+        {
+            mStale = false;
+            materialize(mMatches, mSearchable ? min(int(mMatches.size()), mMaxResults) : mMatches.size());
+        }
+    
+    // reuse option components, only relabelling the ones whose option has changed //
+        void materialize(const vector<int>& indices, int count)
+        {
+            while(children.size() > count){
+                mSpare.push_back(static_cast<ofxDatGuiDropdownOption*>(children.back()));
+                children.pop_back();
+            }
+            for(int i=0; i<count; i++){
+                if (i == children.size()){
+                    ofxDatGuiDropdownOption* opt;
+                    if (mSpare.size() > 0){
+                        opt = mSpare.back();
+                        mSpare.pop_back();
+                    }   else{
+                        opt = new ofxDatGuiDropdownOption(mOptions[indices[i]]);
+                        opt->onButtonEvent(this, &ofxDatGuiDropdown::onOptionSelected);
+                    }
+                // spares & new options missed any theme or width set since they were last attached //
+                    if (mTheme != nullptr) opt->setTheme(mTheme);
+                    if (mLabelWidth > 0) opt->setWidth(mStyle.width, mLabelWidth);
+                    opt->setIndex(-1);
+                    children.push_back(opt);
+                }
+                if (children[i]->getIndex() != indices[i]){
+                    children[i]->setIndex(indices[i]);
+                    children[i]->setLabel(mOptions[indices[i]]);
+                }
+            }
+            ofxDatGuiGroup::layout();
+        }
+    
         int mOption;
+        int mMaxResults;
+        float mLabelWidth;
+        bool mSearchable;
+        bool mStale;
+        string mFilter;
+        const ofxDatGuiTheme* mTheme;
+        vector<string> mOptions;
+        vector<string> mKeys;
+        vector<int> mMatches;
+        vector<pair<string, int>> mPrefix;
+        unordered_map<string, int> mLookup;
+        vector<ofxDatGuiDropdownOption*> mSpare;
     
 };
 
@@ -46,9 +46,7 @@ class ofxDatGuiBreak : public ofxDatGuiComponent{
         {
             if (!mVisible) return;
             ofPushStyle();
-                ofFill();
-                ofSetColor(mStyle.color.background, mStyle.opacity);
-                ofDrawRectangle(x, y, mStyle.width, mStyle.height);
+                ofxDatGuiBatch::rect(x, y, mStyle.width, mStyle.height, ofColor(mStyle.color.background, mStyle.opacity));
             ofPopStyle();
         }
     
@@ -38,33 +38,45 @@ public:
         origin.y = y;
     }
     
-    void draw(int x, int y)
+    // move the button's hit area when the matrix moves //
+    void setOffset(int x, int y)
     {
         mRect.x = x + origin.x;
         mRect.y = y + origin.y;
-        ofPushStyle();
-        ofFill();
-        ofSetColor(mBkgdColor);
-        ofDrawRectangle(mRect);
-        if (mShowLabels) {
-            ofSetColor(mLabelColor);
-            mFont->draw(ofToString(mIndex+1), mRect.x + mRect.width/2 - mFontRect.width/2, mRect.y + mRect.height/2 + mFontRect.height/2);
-        }
-        ofPopStyle();
     }
     
-    void hitTest(ofPoint m, bool mouseDown)
+    // position & size relative to the matrix //
+    ofRectangle getLocalRect()
+    {
+        return ofRectangle(origin.x, origin.y, mRect.width, mRect.height);
+    }
+    
+    ofRectangle getLabelRect()
+    {
+        return mFontRect;
+    }
+    
+    const ofColor& getBackgroundColor()
+    {
+        return mBkgdColor;
+    }
+    
+    const ofColor& getLabelColor()
+    {
+        return mLabelColor;
+    }
+    
+    // returns true if the button changed color //
+    bool hitTest(ofPoint m, bool mouseDown)
     {
         if (mRect.inside(m) && !mSelected){
             if (mouseDown){
-                mBkgdColor = colors.selected.button;
-                mLabelColor = colors.selected.label;
+                return setColors(colors.selected.button, colors.selected.label);
             }   else{
-                mBkgdColor = colors.hover.button;
-                mLabelColor = colors.hover.label;
+                return setColors(colors.hover.button, colors.hover.label);
             }
         }   else{
-            onMouseOut();
+            return onMouseOut();
         }
     }
     
@@ -78,14 +90,12 @@ public:
         return mSelected;
     }
     
-    void onMouseOut()
+    bool onMouseOut()
     {
         if (mSelected){
-            mBkgdColor = colors.selected.button;
-            mLabelColor = colors.selected.label;
+            return setColors(colors.selected.button, colors.selected.label);
         }   else{
-            mBkgdColor = colors.normal.button;
-            mLabelColor = colors.normal.label;
+            return setColors(colors.normal.button, colors.normal.label);
         }
     }
     
@@ -113,6 +123,15 @@ public:
     }
     
 private:
+
+    bool setColors(const ofColor& bkgd, const ofColor& label)
+    {
+        if (bkgd == mBkgdColor && label == mLabelColor) return false;
+        mBkgdColor = bkgd;
+        mLabelColor = label;
+        return true;
+    }
+
     int x;
     int y;
     int mIndex;
@@ -157,6 +176,8 @@ public:
     {
         setComponentStyle(theme);
         mFillColor = theme->color.inputAreaBackground;
+        mCells.setMode(OF_PRIMITIVE_TRIANGLES);
+        mLabels.setMode(OF_PRIMITIVE_TRIANGLES);
         mButtonSize = theme->layout.matrix.buttonSize;
         mButtonPadding = theme->layout.matrix.buttonPadding;
         mStyle.stripe.color = theme->stripe.matrix;
@@ -184,6 +205,8 @@ public:
         }
         mStyle.height = (mStyle.padding*2) + ((mButtonSize + padding) * (nRows - 1)) + mButtonSize;
         mMatrixRect.height = mStyle.height - (mStyle.padding * 2);
+        for(int i=0; i<btns.size(); i++) btns[i].setOffset(x + mLabel.width, y);
+        buildMeshes();
     }
     
     void setPosition(int x, int y)
@@ -191,6 +214,7 @@ public:
         ofxDatGuiComponent::setPosition(x, y);
         mMatrixRect.x = x + mLabel.width;
         mMatrixRect.y = y + mStyle.padding;
+        for(int i=0; i<btns.size(); i++) btns[i].setOffset(x + mLabel.width, y);
     }
     
     void setRadioMode(bool enabled)
@@ -203,10 +227,10 @@ public:
         //m.x -= tx;
         //m.y -= ty;
         if (mMatrixRect.inside(m)){
-            for(int i=0; i<btns.size(); i++) btns[i].hitTest(m, mMouseDown);
+            for(int i=0; i<btns.size(); i++) if (btns[i].hitTest(m, mMouseDown)) updateCell(i);
             return true;
         }   else{
-            for(int i=0; i<btns.size(); i++) btns[i].onMouseOut();
+            for(int i=0; i<btns.size(); i++) if (btns[i].onMouseOut()) updateCell(i);
             return false;
         }
     }
@@ -216,22 +240,37 @@ public:
         if (!mVisible) return;
         ofPushStyle();
         //ofxDatGuiComponent::draw();
-        ofSetColor(mFillColor);
-        ofDrawRectangle(mMatrixRect);
+        ofxDatGuiBatch::rect(mMatrixRect, mFillColor);
         drawLabel();
-        for(int i=0; i<btns.size(); i++) btns[i].draw(x+mLabel.width, y);
+    // all cells are drawn with one mesh & all number labels with another //
+        if (btns.size() > 0){
+            ofxDatGuiRenderer::getRenderer()->custom("matrix.cells", mMatrixRect, [&](){
+                ofPushMatrix();
+                ofTranslate(x + mLabel.width, y);
+                mCells.draw();
+                if (mShowLabels) mFont->draw(mLabels);
+                ofPopMatrix();
+            });
+        }
         ofPopStyle();
     }
     
     void clear()
     {
-        for (int i=0; i<btns.size(); i++) btns[i].setSelected(false);
+        for (int i=0; i<btns.size(); i++) {
+            btns[i].setSelected(false);
+            if (btns[i].onMouseOut()) updateCell(i);
+        }
+        mDirty = true;
     }
     
     void setSelected(vector<int> v)
     {
         clear();
-        for (int i=0; i<v.size(); i++) btns[v[i]].setSelected(true);
+        for (int i=0; i<v.size(); i++) {
+            btns[v[i]].setSelected(true);
+            if (btns[v[i]].onMouseOut()) updateCell(v[i]);
+        }
     }
     
     vector<int> getSelected()
@@ -259,9 +298,15 @@ protected:
     
     void onButtonSelected(ofxDatGuiInternalEvent e)
     {
+        mDirty = true;
         if (mRadioMode) {
             // deselect all buttons save the one that was selected //
-            for(int i=0; i<btns.size(); i++) btns[i].setSelected(e.index == i);
+            for(int i=0; i<btns.size(); i++) {
+                btns[i].setSelected(e.index == i);
+                if (btns[i].onMouseOut()) updateCell(i);
+            }
+        }   else if (btns[e.index].onMouseOut()){
+            updateCell(e.index);
         }
         if (matrixEventCallback != nullptr) {
             ofxDatGuiMatrixEvent ev(this, e.index, btns[e.index].getSelected());
@@ -271,6 +316,49 @@ protected:
         }
     }
     
+    /*
+        cells are stored relative to the matrix as four vertices per button, labels as the glyph
+        quads of each number, so moving the matrix never rebuilds them and a button that changes
+        color only rewrites its own vertex colors
+    */
+    void buildMeshes()
+    {
+        mCells.clear();
+        mLabels.clear();
+        mLabelStart.assign(btns.size() + 1, 0);
+        for(int i=0; i<btns.size(); i++){
+            ofRectangle r = btns[i].getLocalRect();
+            unsigned int v = mCells.getNumVertices();
+            mCells.addVertex(ofPoint(r.x, r.y));
+            mCells.addVertex(ofPoint(r.x + r.width, r.y));
+            mCells.addVertex(ofPoint(r.x + r.width, r.y + r.height));
+            mCells.addVertex(ofPoint(r.x, r.y + r.height));
+            for(int j=0; j<4; j++) mCells.addColor(btns[i].getBackgroundColor());
+            mCells.addIndex(v); mCells.addIndex(v+1); mCells.addIndex(v+2);
+            mCells.addIndex(v); mCells.addIndex(v+2); mCells.addIndex(v+3);
+            mLabelStart[i] = mLabels.getNumVertices();
+            if (mShowLabels){
+                ofRectangle f = btns[i].getLabelRect();
+                ofPoint offset(r.x + r.width/2 - f.width/2, r.y + r.height/2 + f.height/2);
+                ofMesh glyphs = mFont->mesh(ofToString(i+1));
+                unsigned int g = mLabels.getNumVertices();
+                for(auto& p:glyphs.getVertices()) mLabels.addVertex(p + offset);
+                mLabels.addTexCoords(glyphs.getTexCoords());
+                for(int j=0; j<glyphs.getNumVertices(); j++) mLabels.addColor(btns[i].getLabelColor());
+                for(auto j:glyphs.getIndices()) mLabels.addIndex(g + j);
+            }
+        }
+        mLabelStart[btns.size()] = mLabels.getNumVertices();
+        mDirty = true;
+    }
+    
+    void updateCell(int i)
+    {
+        for(int j=0; j<4; j++) mCells.setColor(i*4 + j, btns[i].getBackgroundColor());
+        for(int j=mLabelStart[i]; j<mLabelStart[i+1]; j++) mLabels.setColor(j, btns[i].getLabelColor());
+        mDirty = true;
+    }
+    
     void attachButtons(const ofxDatGuiTheme* theme)
     {
         btns.clear();
@@ -291,6 +379,9 @@ private:
     bool mShowLabels;
     ofColor mFillColor;
     ofRectangle mMatrixRect;
+    ofVboMesh mCells;
+    ofVboMesh mLabels;
+    vector<int> mLabelStart;
     vector<ofxDatGuiMatrixButton> btns;
     
 };
@@ -29,6 +29,9 @@ class ofxDatGuiScrollView : public ofxDatGuiComponent {
     
         ofxDatGuiScrollView(string name, int nVisible = 6) : ofxDatGuiComponent(name)
         {
+            mY = 0;
+            mScrollY = 0;
+            mViewInvalid = true;
             mAutoHeight = true;
             mNumVisible = nVisible;
             setTheme(ofxDatGuiComponent::getTheme());
@@ -47,20 +50,58 @@ class ofxDatGuiScrollView : public ofxDatGuiComponent {
     
         void add(string label)
         {
+            if (getVirtualized()){
+                ofxDatGuiLog::write(ofxDatGuiMsg::LIST_VIRTUALIZED, "ofxDatGuiScrollView::add");
+                return;
+            }
             int y = 0;
             if (children.size() > 0) y = children.back()->getY() + children.back()->getHeight() + mSpacing;
-            children.push_back(new ofxDatGuiButton( label ));
-            children.back()->setMask(mRect);
-            children.back()->setTheme(mTheme);
-            children.back()->setWidth(mRect.width, 0);
-            children.back()->setPosition(0, y);
-            children.back()->onButtonEvent(this, &ofxDatGuiScrollView::onButtonEvent);
+            addRow(label, y);
         //  cout << "ofxDatGuiScrollView :: total items = " << children.size() << endl;
             if (mAutoHeight) autoSize();
         }
     
+    /*
+        virtualized lists pull their entries from a data source and only keep enough buttons
+        to fill the visible window, the buttons are recycled as the list scrolls
+    */
+    
+        void setDataSource(function<int()> count, function<string(int)> labelAt)
+        {
+            clear();
+            mDataCount = count;
+            mDataLabel = labelAt;
+            mScrollY = 0;
+            reloadData();
+        }
+    
+    // call when the number of entries or their labels have changed //
+        void reloadData()
+        {
+            if (getVirtualized() == false) return;
+            int rowHeight = mTheme->layout.height + mSpacing;
+            int nRows = ceil(mRect.height / float(rowHeight)) + 1;
+            while(children.size() < nRows) addRow("", 0);
+            while(children.size() > nRows){
+                delete children.back();
+                children.pop_back();
+            }
+            mRowIndex.assign(children.size(), -1);
+            scrollTo(mScrollY);
+        }
+    
+        bool getVirtualized()
+        {
+            return mDataCount != nullptr;
+        }
+    
+    // virtualized lists return the button showing this entry or nullptr if it's scrolled out of view //
         ofxDatGuiButton* get(int index)
         {
+            if (getVirtualized()){
+                for(int i=0; i<mRowIndex.size(); i++) if (mRowIndex[i] == index) return static_cast<ofxDatGuiButton*>(children[i]);
+                return nullptr;
+            }
             return static_cast<ofxDatGuiButton*>(children[index]);
         }
     
@@ -70,8 +111,10 @@ class ofxDatGuiScrollView : public ofxDatGuiComponent {
             return nullptr;
         }
     
+    // the order of a virtualized list is owned by its data source, reorder the data & call reloadData() //
         void swap(int index1, int index2)
         {
+            if (rejectVirtualized("ofxDatGuiScrollView::swap")) return;
             if (isValidIndex(index1) && isValidIndex(index2) && index1 != index2){
                 std::swap(children[index1], children[index2]);
                 positionItems();
@@ -80,6 +123,7 @@ class ofxDatGuiScrollView : public ofxDatGuiComponent {
     
         void move(int from, int to)
         {
+            if (rejectVirtualized("ofxDatGuiScrollView::move")) return;
             if (isValidIndex(from) && isValidIndex(to) && from != to){
                 auto itr_from = children.begin() + from;
                 auto itr_to = children.begin() + to;
@@ -98,6 +142,7 @@ class ofxDatGuiScrollView : public ofxDatGuiComponent {
     
         void move(ofxDatGuiComponent* item, int index)
         {
+            if (rejectVirtualized("ofxDatGuiScrollView::move")) return;
             for(int i=0; i<children.size(); i++){
                 if (children[i] == item) {
                     move(i, index); return;
@@ -109,23 +154,31 @@ class ofxDatGuiScrollView : public ofxDatGuiComponent {
         {
             for (auto i:children) delete i;
             children.clear();
+            mRowIndex.clear();
+            mDataCount = nullptr;
+            mDataLabel = nullptr;
+            mViewInvalid = true;
         }
     
         void remove(int index)
         {
+            if (rejectVirtualized("ofxDatGuiScrollView::remove")) return;
             if (isValidIndex(index)) {
                 delete children[index];
                 children.erase(children.begin()+index);
+                mViewInvalid = true;
             }
             positionItems();
         }
     
         void remove(ofxDatGuiComponent* item)
         {
+            if (rejectVirtualized("ofxDatGuiScrollView::remove")) return;
             for(int i=0; i<children.size(); i++){
                 if (children[i] == item) {
                     delete children[i];
                     children.erase(children.begin()+i);
+                    mViewInvalid = true;
                     positionItems(); return;
                 }
             }
@@ -157,7 +210,7 @@ class ofxDatGuiScrollView : public ofxDatGuiComponent {
     
         int getNumItems()
         {
-            return children.size();
+            return getVirtualized() ? mDataCount() : children.size();
         }
     
     /*
@@ -169,6 +222,7 @@ class ofxDatGuiScrollView : public ofxDatGuiComponent {
             mTheme = theme;
             mSpacing = theme->layout.vMargin;
             mBackground = theme->color.guiBackground;
+            mViewInvalid = true;
             for (auto i:children) i->setTheme(theme);
             setWidth(theme->layout.width, theme->layout.labelWidth);
         }
@@ -178,6 +232,7 @@ class ofxDatGuiScrollView : public ofxDatGuiComponent {
             mRect.width = width;
             for (auto i:children) i->setWidth(mRect.width, labelWidth);
             if (mAutoHeight) autoSize();
+            reloadData();
         }
     
         void setHeight(int height)
@@ -185,6 +240,8 @@ class ofxDatGuiScrollView : public ofxDatGuiComponent {
             mAutoHeight = false;
             mRect.height = height;
             if (mRect.width > 0 && mRect.height > 0) mView.allocate( mRect.width, mRect.height );
+            mViewInvalid = true;
+            reloadData();
         }
 
         void setPosition(int x, int y)
@@ -201,6 +258,7 @@ class ofxDatGuiScrollView : public ofxDatGuiComponent {
         void setBackgroundColor(ofColor color)
         {
             mBackground = color;
+            mViewInvalid = true;
         }
     
     /*
@@ -214,22 +272,25 @@ class ofxDatGuiScrollView : public ofxDatGuiComponent {
     
         void draw()
         {
-            ofPushStyle();
-                ofFill();
-            // draw a background behind the fbo //
-                ofSetColor(ofColor::black);
-                ofDrawRectangle(mRect);
-            // draw into the fbo //
-                mView.begin();
-                ofClear(255,255,255,0);
-                ofSetColor(mBackground);
-                ofDrawRectangle(0, 0, mRect.width, mRect.height);
-                for(auto i:children) i->draw();
-                mView.end();
+        // draw a background behind the fbo //
+            ofxDatGuiBatch::rect(mRect, ofColor::black);
+            ofxDatGuiRenderer::getRenderer()->custom("scrollview", mRect, [&](){
+                ofPushStyle();
+            // only re-render the list when it has scrolled, been modified or a row has changed //
+                if (mViewInvalid || getDirty()){
+                    mView.begin();
+                    ofClear(255,255,255,0);
+                    ofxDatGuiBatch::rect(0, 0, mRect.width, mRect.height, mBackground);
+                    for(auto i:children) i->draw();
+                    mView.end();
+                    mViewInvalid = false;
+                    setDirty(false);
+                }
             // draw the fbo of list content //
                 ofSetColor(ofColor::white);
                 mView.draw(mRect.x, mRect.y);
-            ofPopStyle();
+                ofPopStyle();
+            });
         }
 
     private:
@@ -240,18 +301,62 @@ class ofxDatGuiScrollView : public ofxDatGuiComponent {
         const ofxDatGuiTheme* mTheme;
     
         int mY;
+        int mScrollY;
         int mSpacing;
         int mNumVisible;
         bool mAutoHeight;
+        bool mViewInvalid;
+        vector<int> mRowIndex;
+        function<int()> mDataCount;
+        function<string(int)> mDataLabel;
+    
+        void addRow(string label, int y)
+        {
+            children.push_back(new ofxDatGuiButton( label ));
+            children.back()->setMask(mRect);
+            children.back()->setTheme(mTheme);
+            children.back()->setWidth(mRect.width, 0);
+            children.back()->setPosition(0, y);
+            children.back()->onButtonEvent(this, &ofxDatGuiScrollView::onButtonEvent);
+        }
+    
+    // entry i is always shown by button i % pool size so scrolling one row only relabels one button //
+        void scrollTo(int scrollY)
+        {
+            int count = mDataCount();
+            int rowHeight = mTheme->layout.height + mSpacing;
+            int maxY = max(0, count * rowHeight - mSpacing - int(mRect.height));
+            mScrollY = ofClamp(scrollY, 0, maxY);
+            int first = mScrollY / rowHeight;
+            for(int index = first; index < first + children.size(); index++){
+                int slot = index % children.size();
+                if (index >= count){
+                    if (children[slot]->getVisible()) children[slot]->setVisible(false);
+                    mRowIndex[slot] = -1;
+                    continue;
+                }
+                if (mRowIndex[slot] != index){
+                    children[slot]->setLabel(mDataLabel(index));
+                    children[slot]->setVisible(true);
+                    mRowIndex[slot] = index;
+                }
+                children[slot]->setPosition(0, index * rowHeight - mScrollY);
+            }
+        }
     
         void autoSize()
         {
             mRect.height = ((mTheme->layout.height + mSpacing) * mNumVisible) - mSpacing;
             if (mRect.width > 0 && mRect.height > 0) mView.allocate( mRect.width, mRect.height );
+            mViewInvalid = true;
         }
     
         void onMouseScrolled(ofMouseEventArgs &e)
         {
+            if (getVirtualized()){
+                if (mRect.inside(e.x, e.y)) scrollTo(mScrollY - e.scrollY * 2);
+                return;
+            }
             if (children.size() > 0 && mRect.inside(e.x, e.y) == true){
                 float sy = e.scrollY * 2;
                 int btnH = children.front()->getHeight() + mSpacing;
@@ -283,6 +388,7 @@ class ofxDatGuiScrollView : public ofxDatGuiComponent {
             if (scrollViewEventCallback != nullptr) {
                 int i = 0;
                 for(i; i<children.size(); i++) if (children[i] == e.target) break;
+                if (getVirtualized()) i = mRowIndex[i];
                 ofxDatGuiScrollViewEvent e1(this, e.target, i);
                 scrollViewEventCallback(e1);
             }   else{
@@ -303,5 +409,12 @@ class ofxDatGuiScrollView : public ofxDatGuiComponent {
         {
             return index >= 0 && index < children.size();
         }
+    
+    // the buttons of a virtualized list are a recycled pool, editing them would corrupt the view //
+        bool rejectVirtualized(string method)
+        {
+            if (getVirtualized()) ofxDatGuiLog::write(ofxDatGuiMsg::LIST_VIRTUALIZED, method);
+            return getVirtualized();
+        }
 
 };
@@ -23,6 +23,7 @@
 #pragma once
 #include "ofxDatGuiComponent.h"
 #include "ofxDatGuiTextInputField.h"
+#include "ofxDatGuiFormat.h"
 
 class ofxDatGuiSlider : public ofxDatGuiComponent {
     
@@ -113,11 +114,13 @@ public:
         p1.x = (int) x - 12;
         p1.y = (int) y+mStyle.padding + 11;
         inputConnection->setup(p1, this->getName());
+        ofxDatGuiWireIndex::place(this, ofxDatGuiWireIndex::INPUT, p1);
         
         ofPoint p2;
         p2.x = (int) x+mSliderWidth + mInput->getWidth() + 15;
         p2.y = (int) y+mStyle.padding + 11;
         outputConnection->setup(p2, this->getName());
+        ofxDatGuiWireIndex::place(this, ofxDatGuiWireIndex::OUTPUT, p2);
         
         inputConnection->setScale(&mScale);
         outputConnection->setScale(&mScale);
@@ -127,7 +130,9 @@ public:
     {
         mPrecision = precision;
         mTruncateValue = truncateValue;
+        mSynced = NAN;
         if (mPrecision > MAX_PRECISION) mPrecision = MAX_PRECISION;
+        mDirty = true;
         return this;
     }
     
@@ -139,6 +144,7 @@ public:
     void setMin(float min)
     {
         mMin = min;
+        mSynced = NAN;
         if (mMin < mMax){
             calculateScale();
         }   else{
@@ -149,6 +155,7 @@ public:
     void setMax(float max)
     {
         mMax = max;
+        mSynced = NAN;
         if (mMax > mMin){
             calculateScale();
         }   else{
@@ -158,6 +165,9 @@ public:
     
     void setValue(double value)
     {
+    // a bound variable overrides values set from anywhere else on the next update //
+        mSynced = NAN;
+        double previous = mValue;
         mValue = value;
         if (mValue > mMax){
             mValue = mMax;
@@ -166,6 +176,7 @@ public:
         }
         if (mTruncateValue) mValue = round(mValue, mPrecision);
         calculateScale();
+        if (mValue != previous) mDirty = true;
     }
     
     double getValue()
@@ -193,15 +204,16 @@ public:
         if (mTruncateValue == false){
             cout << setprecision(16) << getValue() << endl;
         }   else{
-            int n = ofToString(mValue).find(".");
-            if (n == -1) n = ofToString(mValue).length();
-            cout << setprecision(mPrecision + n) << mValue << endl;
+            char v[ofxDatGuiFormat::BUFFER_SIZE];
+            ofxDatGuiFormat::fixed(v, mValue, mPrecision, false);
+            cout << v << endl;
         }
     }
     
     void setComponentScale(double scale)
     {
         mScale = scale;
+        mDirty = true;
         if(mBoundi != nullptr) {
             int sc = ((mMax-mMin) * mScale) + mMin;
             *mBoundi = sc;
@@ -222,6 +234,8 @@ public:
             mScale = 0.5f;
         }
         mValue = ((mMax-mMin) * mScale) + mMin;
+        mSynced = NAN;
+        mDirty = true;
     }
     
     double getScale()
@@ -236,12 +250,16 @@ public:
     {
         mBoundi = &val;
         mBoundf = nullptr;
+        mSynced = NAN;
+        wakePanel();
     }
     
     void bind(float &val)
     {
         mBoundf = &val;
         mBoundi = nullptr;
+        mSynced = NAN;
+        wakePanel();
     }
     
     void bind(int &val, int min, int max)
@@ -250,6 +268,9 @@ public:
         mMax = max;
         mBoundi = &val;
         mBoundf = nullptr;
+        mDirty = true;
+        mSynced = NAN;
+        wakePanel();
     }
     
     void bind(float &val, float min, float max)
@@ -258,6 +279,9 @@ public:
         mMax = max;
         mBoundf = &val;
         mBoundi = nullptr;
+        mDirty = true;
+        mSynced = NAN;
+        wakePanel();
     }
     
     void update(bool acceptEvents = true)
@@ -265,13 +289,32 @@ public:
         
         ofxDatGuiComponent::update(acceptEvents);
         // check for variable bindings //
+        // only reformat when the bound variable changed since the last sync //
         if (mBoundf != nullptr && !mInput->hasFocus()) {
-            setValue(*mBoundf);
+            if (*mBoundf != mSynced){
+                setValue(*mBoundf);
+                mSynced = *mBoundf;
+            }
         }   else if (mBoundi != nullptr && !mInput->hasFocus()){
-            setValue(*mBoundi);
+            if (*mBoundi != mSynced){
+                setValue(*mBoundi);
+                mSynced = *mBoundi;
+            }
         }
     }
     
+    bool getBound()
+    {
+        return mBoundf != nullptr || mBoundi != nullptr;
+    }
+    
+    bool getStale()
+    {
+        if (mBoundf != nullptr) return *mBoundf != mSynced;
+        if (mBoundi != nullptr) return *mBoundi != mSynced;
+        return false;
+    }
+    
     void draw()
     {
         if (!mVisible) return;
@@ -279,12 +322,10 @@ public:
         ofxDatGuiComponent::draw();
         
         // slider bkgd //
-        ofSetColor(mBackgroundFill);
-        ofDrawRectangle(x, y+mStyle.padding, mSliderWidth, mStyle.height-(mStyle.padding*2));
+        ofxDatGuiBatch::rect(x, y+mStyle.padding, mSliderWidth, mStyle.height-(mStyle.padding*2), mBackgroundFill);
         // slider fill //
         if (mScale > 0){
-            ofSetColor(mSliderFill);
-            ofDrawRectangle(x, y+mStyle.padding, mSliderWidth*mScale, mStyle.height-(mStyle.padding*2));
+            ofxDatGuiBatch::rect(x, y+mStyle.padding, mSliderWidth*mScale, mStyle.height-(mStyle.padding*2), mSliderFill);
         }
         
 
@@ -295,20 +336,39 @@ public:
         // numeric input field //
         if(getMidiMode())
         {
-            ofSetColor(getMidiMap() ? ofColor(70, 128) : ofColor(0, 200));
-            ofDrawRectangle(x, y+mStyle.padding, mSliderWidth, mStyle.height-(mStyle.padding*2));
+            ofColor overlay = getMidiMap() ? ofColor(70, 128) : ofColor(0, 200);
+        // the overlay dims the label & value so their batched text has to be drawn first //
+            ofxDatGuiBatch::flushText();
+            ofxDatGuiBatch::rect(x, y+mStyle.padding, mSliderWidth, mStyle.height-(mStyle.padding*2), overlay);
             
-            ofDrawRectangle(x + mSliderWidth+(mStyle.padding), y+mStyle.padding, mInput->getWidth(), mStyle.height-(mStyle.padding*2));
-            ofSetColor(ofColor(255));
-
-            mFont->draw(mappingString, x + 5, y+mStyle.padding + mStyle.height/2 + 2);
+            ofxDatGuiBatch::rect(x + mSliderWidth+(mStyle.padding), y+mStyle.padding, mInput->getWidth(), mStyle.height-(mStyle.padding*2), overlay);
+            ofxDatGuiRenderer::getRenderer()->text(mFont, mappingString, nullptr, x + 5, y+mStyle.padding + mStyle.height/2 + 2, ofColor(255));
                
         }
         
-        outputConnection->draw();
-        inputConnection->draw();
-        
         ofPopStyle();
+    // a slider that isn't drawn by a panel draws its own connectors //
+        if (mPanelDrawing == false) drawWireConnections();
+    }
+    
+    void drawReduced()
+    {
+        if (!mVisible) return;
+        ofxDatGuiComponent::drawReduced();
+        ofxDatGuiBatch::rect(x, y+mStyle.padding, mSliderWidth, mStyle.height-(mStyle.padding*2), mBackgroundFill);
+        if (mScale > 0){
+            ofxDatGuiBatch::rect(x, y+mStyle.padding, mSliderWidth*mScale, mStyle.height-(mStyle.padding*2), mSliderFill);
+        }
+    }
+    
+    // drawn by the gui panel after all of its components so they can overlap neighbours //
+    void drawWireConnections()
+    {
+        if (!mVisible) return;
+        ofxDatGuiRenderer::getRenderer()->custom("wires", ofRectangle(x, y, mStyle.width, mStyle.height), [&](){
+            outputConnection->draw();
+            inputConnection->draw();
+        });
     }
     
     bool hitTest(ofPoint m)
@@ -351,6 +411,7 @@ protected:
             mScale = s;
             mValue = ((mMax-mMin) * mScale) + mMin;
             if (mTruncateValue) mValue = round(mValue, mPrecision);
+            mDirty = true;
             setTextInput();
             dispatchSliderChangedEvent();
         }
@@ -417,10 +478,12 @@ private:
     ofColor mBackgroundFill;
     ofxDatGuiTextInputField* mInput;
         
-    static const int MAX_PRECISION = 4;
+    static const int MAX_PRECISION = ofxDatGuiFormat::MAX_PRECISION;
+    char    mFormatted[ofxDatGuiFormat::BUFFER_SIZE];
     
     int*    mBoundi = nullptr;
     float*  mBoundf = nullptr;
+    double  mSynced = NAN;
     ofParameter<int>* mParamI = nullptr;
     ofParameter<float>* mParamF = nullptr;
     void onParamI(int& n) { setValue(n); }
@@ -428,28 +491,23 @@ private:
     
     void calculateScale()
     {
-        mScale = ofxDatGuiScale(mValue, mMin, mMax);
+        double scale = ofxDatGuiScale(mValue, mMin, mMax);
+        if (scale != mScale) mDirty = true;
+        mScale = scale;
         setTextInput();
     }
     
     
+    // values between min & max are padded to a fixed number of decimals //
     void setTextInput()
     {
-        string v = ofToString(round(mValue, mPrecision));
-        if (mValue != mMin && mValue != mMax){
-            int p = v.find('.');
-            if (p == -1 && mPrecision != 0){
-                v+='.';
-                p = v.find('.');
-            }
-            while(v.length() - p < (mPrecision + 1)) v+='0';
-        }
-        mInput->setText(v);
+        int n = ofxDatGuiFormat::fixed(mFormatted, mValue, mPrecision, mValue != mMin && mValue != mMax);
+        mInput->setText(mFormatted, n);
     }
     
     double round(double num, int precision)
     {
-        return roundf(num * pow(10, precision)) / pow(10, precision);
+        return ofxDatGuiFormat::round(num, precision);
     }
     
     void onInvalidMinMaxValues()
@@ -60,6 +60,7 @@ class ofxDatGuiTextInput : public ofxDatGuiComponent {
         void setText(string text)
         {
             mInput.setText(text);
+            mDirty = true;
         }
     
         string getText()
@@ -70,6 +71,7 @@ class ofxDatGuiTextInput : public ofxDatGuiComponent {
         void setTextUpperCase(bool toUpper)
         {
             mInput.setTextUpperCase(toUpper);
+            mDirty = true;
         }
     
         bool getTextUpperCase()
@@ -80,6 +82,7 @@ class ofxDatGuiTextInput : public ofxDatGuiComponent {
         void setInputType(ofxDatGuiInputType type)
         {
             mInput.setTextInputFieldType(type);
+            mDirty = true;
         }
     
         void draw()
@@ -70,11 +70,10 @@ class ofxDatGuiTextInputField : public ofxDatGuiInteractiveObject{
             ofPushStyle();
             // draw the input field background //
                 if (mFocused && mType != ofxDatGuiInputType::COLORPICKER){
-                    ofSetColor(color.active.background);
+                    ofxDatGuiBatch::rect(mInputRect, color.active.background);
                 }   else {
-                    ofSetColor(color.inactive.background);
+                    ofxDatGuiBatch::rect(mInputRect, color.inactive.background);
                 }
-                ofDrawRectangle(mInputRect);
             // draw the highlight rectangle //
                 if (mHighlightText){
                     ofRectangle hRect;
@@ -82,16 +81,14 @@ class ofxDatGuiTextInputField : public ofxDatGuiInteractiveObject{
                     hRect.width = mTextRect.width + (mHighlightPadding * 2);
                     hRect.y = ty - mHighlightPadding - mTextRect.height;
                     hRect.height = mTextRect.height + (mHighlightPadding * 2);
-                    ofSetColor(color.highlight);
-                    ofDrawRectangle(hRect);
+                    ofxDatGuiBatch::rect(hRect, color.highlight);
                 }
             // draw the text //
                 ofColor tColor = mHighlightText ? color.active.text : color.inactive.text;
-                ofSetColor(tColor);
-                mFont->draw(mType == ofxDatGuiInputType::COLORPICKER ? "#" + mRendered : mRendered, tx, ty);
+                ofxDatGuiRenderer::getRenderer()->text(mFont, mType == ofxDatGuiInputType::COLORPICKER ? "#" + mRendered : mRendered, nullptr, tx, ty, tColor);
                 if (mFocused) {
             // draw the cursor //
-                    ofDrawLine(ofPoint(tx + mCursorX, mInputRect.getTop()), ofPoint(tx + mCursorX, mInputRect.getBottom()));
+                    ofxDatGuiRenderer::getRenderer()->line(tx + mCursorX, mInputRect.getTop(), tx + mCursorX, mInputRect.getBottom(), tColor);
                 }
             ofPopStyle();
         }
@@ -124,6 +121,17 @@ class ofxDatGuiTextInputField : public ofxDatGuiInteractiveObject{
             mTextRect = mFont->rect(mType == ofxDatGuiInputType::COLORPICKER ? "#" + mRendered : mRendered);
         }
     
+    // copies into the existing string storage & skips re-measuring when nothing changed //
+        void setText(const char* text, size_t length)
+        {
+            if (mText.size() == length && mText.compare(0, length, text, length) == 0) return;
+            mText.assign(text, length);
+            mTextChanged = true;
+            mRendered.assign(text, length);
+            if (mUpperCaseText) for (auto &c:mRendered) c = toupper(c);
+            mTextRect = mFont->rect(mType == ofxDatGuiInputType::COLORPICKER ? "#" + mRendered : mRendered);
+        }
+    
         string getText()
         {
             return mText;
@@ -39,6 +39,7 @@ class ofxDatGuiTimeGraph : public ofxDatGuiComponent {
 				case ofxDatGuiGraph::OUTLINE : mDrawFunc = &ofxDatGuiTimeGraph::drawOutline;
                 break;
             }
+            mDirty = true;
         }
 
     protected:
@@ -68,6 +69,7 @@ class ofxDatGuiTimeGraph : public ofxDatGuiComponent {
             mPlotterRect.y = mStyle.padding;
             mPlotterRect.width = mStyle.width - mStyle.padding - mLabel.width;
             mPlotterRect.height = mStyle.height - (mStyle.padding*2);
+            allocate(mSpacing);
         }
     
         void draw()
@@ -75,63 +77,130 @@ class ofxDatGuiTimeGraph : public ofxDatGuiComponent {
             if (!mVisible) return;
             ofPushStyle();
                 ofxDatGuiComponent::draw();
-                ofSetColor(mStyle.color.inputArea);
-                ofDrawRectangle(x + mPlotterRect.x, y + mPlotterRect.y, mPlotterRect.width, mPlotterRect.height);
-                glColor3ub(mColor.fills.r, mColor.fills.g, mColor.fills.b);
-                (*this.*mDrawFunc)();
+                ofxDatGuiBatch::rect(x + mPlotterRect.x, y + mPlotterRect.y, mPlotterRect.width, mPlotterRect.height, mStyle.color.inputArea);
+                if (mCount > 0){
+                    ofRectangle bounds(x + mPlotterRect.x, y + mPlotterRect.y, mPlotterRect.width, mPlotterRect.height);
+                    ofxDatGuiRenderer::getRenderer()->custom("timegraph.plot", bounds, [&](){
+                        int start = getFirstSlot();
+                    // shift the buffer so the newest sample sits on the right edge of the plot //
+                        ofPushMatrix();
+                        ofTranslate(bounds.x + bounds.width - (start + mCount - 1) * mSpacing, bounds.y);
+                        ofSetColor(mColor.fills);
+                        (*this.*mDrawFunc)(start);
+                        ofPopMatrix();
+                    });
+                }
             ofPopStyle();
         }
     
-        void drawFilled()
+        void drawFilled(int start)
         {
-            float px = this->x + mPlotterRect.x;
-            float py = this->y + mPlotterRect.y;
-            glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
-            glBegin(GL_TRIANGLE_STRIP);
-            for (int i=0; i<pts.size(); i++) {
-                glVertex2f(px+ pts[i].x, py + mPlotterRect.height);
-                glVertex2f(px+ pts[i].x, py + pts[i].y);
-            }
-            glEnd();
+            mFill.draw(GL_TRIANGLE_STRIP, start * 2, mCount * 2);
         }
 
-        void drawOutline()
+        void drawOutline(int start)
         {
-            float px = this->x + mPlotterRect.x;
-            float py = this->y + mPlotterRect.y;
-            glLineWidth(mLineWeight);
-            glBegin(GL_LINE_LOOP);
-            glVertex2f(px+mPlotterRect.width, py+mPlotterRect.height);
-            for (int i=0; i<pts.size(); i++) glVertex2f(px+pts[i].x, py+pts[i].y);
-            glVertex2f(px, py+mPlotterRect.height);
-            glEnd();
+            float right = (start + mCount - 1) * mSpacing;
+            ofSetLineWidth(mLineWeight);
+            mLine.draw(GL_LINE_STRIP, start, mCount);
+            ofDrawLine(right, mSamples[(start + mCount - 1) % mSamples.size()], right, mPlotterRect.height);
+            ofDrawLine(right, mPlotterRect.height, right - mPlotterRect.width, mPlotterRect.height);
+            ofDrawLine(right - mPlotterRect.width, mPlotterRect.height, start * mSpacing, mSamples[start]);
         }
     
-        void drawLines()
+        void drawLines(int start)
         {
-            float px = this->x + mPlotterRect.x;
-            float py = this->y + mPlotterRect.y;
-            glLineWidth(mLineWeight);
-            glBegin(GL_LINE_STRIP);
-            for (int i=0; i<pts.size(); i++) glVertex2f(px+pts[i].x, py+pts[i].y);
-            glEnd();
+            ofSetLineWidth(mLineWeight);
+            mLine.draw(GL_LINE_STRIP, start, mCount);
         }
     
-        void drawPoints()
+        void drawPoints(int start)
         {
-            float px = this->x + mPlotterRect.x;
-            float py = this->y + mPlotterRect.y;
             glPointSize(mLineWeight);
-            glLineWidth(mLineWeight);
-            glBegin(GL_POINTS);
-            for (int i=0; i<pts.size(); i++) glVertex2f(px+pts[i].x, py+pts[i].y);
-            glEnd();
+            mLine.draw(GL_POINTS, start, mCount);
         }
     
         void setPosition(int x, int y)
         {
             ofxDatGuiComponent::setPosition(x, y);
         }
+    
+    /*
+        samples are kept in a ring buffer sized to the plot width. every slot is mirrored
+        at i & i+capacity in the vertex buffers so the visible window is always contiguous
+        and can be drawn with an offset, a new sample only rewrites its own slot.
+    */
+    
+        void allocate(float spacing)
+        {
+        // keep the most recent samples, rescaled to the new plot height, so resizing or re-theming doesn't wipe the history //
+            vector<float> history(mCount);
+            float scale = mSampleHeight > 0 ? mPlotterRect.height / mSampleHeight : 1;
+            for (int i=0; i<mCount; i++) history[i] = mSamples[(getFirstSlot() + i) % mSamples.size()] * scale;
+            mSpacing = spacing;
+            int capacity = max(1, int(mPlotterRect.width / mSpacing) + 1);
+            mSamples.assign(capacity, mPlotterRect.height);
+            mLineVerts.resize(capacity * 2);
+            mFillVerts.resize(capacity * 4);
+            for (int i=0; i<capacity * 2; i++) {
+                mLineVerts[i] = ofDefaultVertexType(i * mSpacing, mPlotterRect.height, 0);
+                mFillVerts[i*2] = ofDefaultVertexType(i * mSpacing, mPlotterRect.height, 0);
+                mFillVerts[i*2+1] = mLineVerts[i];
+            }
+            mHead = 0;
+            mCount = 0;
+            mSampleHeight = mPlotterRect.height;
+            for (int i=max(0, int(history.size()) - capacity); i<history.size(); i++) store(history[i]);
+        // only grow the gpu buffers, a smaller plot reuses what is already allocated //
+            if (mLineVerts.size() > mAllocated){
+                mAllocated = mLineVerts.size();
+                mLine.setVertexData(&mLineVerts[0], mLineVerts.size(), GL_DYNAMIC_DRAW);
+                mFill.setVertexData(&mFillVerts[0], mFillVerts.size(), GL_DYNAMIC_DRAW);
+            }   else{
+                upload();
+            }
+            mDirty = true;
+        }
+    
+        void clear()
+        {
+            mHead = 0;
+            mCount = 0;
+            mDirty = true;
+        }
+    
+    // append a sample, y is in plot coordinates, and upload only the slot it occupies //
+        void push(float y)
+        {
+            int slot = store(y);
+            uploadSlot(slot);
+            uploadSlot(slot + mSamples.size());
+        }
+    
+    // append a sample without touching the gpu, call upload() once the batch is written //
+        int store(float y)
+        {
+            int slot = mHead;
+            int n = mSamples.size();
+            mSamples[slot] = y;
+            mLineVerts[slot].y = mLineVerts[slot + n].y = y;
+            mFillVerts[slot*2+1].y = mFillVerts[(slot + n)*2+1].y = y;
+            mHead = (mHead + 1) % n;
+            if (mCount < n) mCount++;
+            mDirty = true;
+            return slot;
+        }
+    
+        void upload()
+        {
+            mLine.updateVertexData(&mLineVerts[0], mLineVerts.size());
+            mFill.updateVertexData(&mFillVerts[0], mFillVerts.size());
+        }
+    
+        int getFirstSlot()
+        {
+            return (mHead - mCount + mSamples.size()) % mSamples.size();
+        }
 
         int mPointSize;
         int mLineWeight;
@@ -139,9 +208,29 @@ class ofxDatGuiTimeGraph : public ofxDatGuiComponent {
             ofColor lines;
             ofColor fills;
         } mColor;
-        vector<ofVec2f> pts;
         ofRectangle mPlotterRect;
-        void (ofxDatGuiTimeGraph::*mDrawFunc)() = nullptr;
+        void (ofxDatGuiTimeGraph::*mDrawFunc)(int) = nullptr;
+    
+        int mHead = 0;
+        int mCount = 0;
+        float mSpacing = 1.0f;
+        float mSampleHeight = 0;
+        vector<float> mSamples;
+    
+    private:
+    
+        void uploadSlot(int slot)
+        {
+            size_t size = sizeof(ofDefaultVertexType);
+            mLine.getVertexBuffer().updateData(slot * size, size, &mLineVerts[slot]);
+            mFill.getVertexBuffer().updateData(slot * 2 * size, size * 2, &mFillVerts[slot*2]);
+        }
+    
+        ofVbo mLine;
+        ofVbo mFill;
+        size_t mAllocated = 0;
+        vector<ofDefaultVertexType> mLineVerts;
+        vector<ofDefaultVertexType> mFillVerts;
 };
 
 class ofxDatGuiWaveMonitor : public ofxDatGuiTimeGraph {
@@ -150,6 +239,10 @@ class ofxDatGuiWaveMonitor : public ofxDatGuiTimeGraph {
 
         ofxDatGuiWaveMonitor(string label, float frequency, float amplitude) : ofxDatGuiTimeGraph(label)
         {
+            mPhase = 0;
+            mStep = 0;
+            mYAmp = 0;
+            mFrequency = 0;
             mFrequencyLimit = 100;
             setAmplitude(amplitude);
             setFrequency(frequency);
@@ -199,24 +292,35 @@ class ofxDatGuiWaveMonitor : public ofxDatGuiTimeGraph {
             graph();
         }
     
+    // the phase advances by a fractional step per sample so any frequency keeps its exact pitch //
         void graph()
         {
-            pts.clear();
-            float step = 1.0/mPlotterRect.width;
-            float yAmp = (mPlotterRect.height/2) * (mAmplitude/float(MAX_AMPLITUDE));
-            for (int i=mPlotterRect.width; i>0; i--) {
-                float yp = mPlotterRect.height/2 + (sin((i*step)*(2*mFrequency)*PI) * yAmp);
-                pts.push_back(ofVec2f(i, yp));
-            }
+            mYAmp = (mPlotterRect.height/2) * (mAmplitude/float(MAX_AMPLITUDE));
+            mStep = mPlotterRect.width > 0 ? (2*PI*mFrequency) / mPlotterRect.width : 0;
+            mPhase = 0;
+            clear();
+            for (int i=0; i<mSamples.size(); i++) store(sample());
+            upload();
         }
     
+    // scroll by advancing the phase one sample //
         void update(bool ignoreMouseEvents)
         {
-            pts[0].y = pts[pts.size()-1].y;
-            for (int i=mPlotterRect.width-1; i>0; i--) pts[i].y = pts[i-1].y;
+            push(sample());
         }
     
     private:
+    
+        float sample()
+        {
+            float y = mPlotterRect.height/2 + (sin(mPhase) * mYAmp);
+            mPhase = fmod(mPhase + mStep, float(2*PI));
+            return y;
+        }
+    
+        float mPhase;
+        float mStep;
+        float mYAmp;
         float mAmplitude;
         float mFrequency;
         float mFrequencyLimit;
@@ -231,6 +335,8 @@ class ofxDatGuiValuePlotter : public ofxDatGuiTimeGraph {
         ofxDatGuiValuePlotter(string label, float min, float max) : ofxDatGuiTimeGraph(label)
         {
             mSpeed = 5.0f;
+            mPushed = false;
+            allocate(mSpeed);
             setRange(min, max);
             mType = ofxDatGuiType::VALUE_PLOTTER;
         }
@@ -250,8 +356,8 @@ class ofxDatGuiValuePlotter : public ofxDatGuiTimeGraph {
         void setSpeed(float speed)
         {
             if (speed != mSpeed){
-                pts.clear();
                 mSpeed = speed;
+                allocate(mSpeed);
             }
         }
 
@@ -265,6 +371,29 @@ class ofxDatGuiValuePlotter : public ofxDatGuiTimeGraph {
             }
         }
     
+    // plot a sample immediately, any number of samples can be pushed per frame //
+        void pushValue(float value)
+        {
+            setValue(value);
+            push(toPlotY(mVal));
+            mPushed = true;
+            wakePanel();
+        }
+    
+    // plot several samples with a single upload, only the newest that fit the plot are kept //
+        void pushValues(const vector<float>& values)
+        {
+            if (values.size() == 0) return;
+            int first = max(0, int(values.size()) - int(mSamples.size()));
+            for (int i=first; i<values.size(); i++) {
+                setValue(values[i]);
+                store(toPlotY(mVal));
+            }
+            upload();
+            mPushed = true;
+            wakePanel();
+        }
+    
         float getMin()
         {
             return mMin;
@@ -280,25 +409,21 @@ class ofxDatGuiValuePlotter : public ofxDatGuiTimeGraph {
             return mMax-mMin;
         }
     
+    // repeat the last value unless samples were pushed since the previous frame //
         void update(bool ignoreMouseEvents)
         {
-        // shift all points over before adding new value //
-            for (int i=0; i<pts.size(); i++) pts[i].x -= mSpeed;
-            int i = 0;
-            while(i < pts.size())
-            {
-                if (pts.at(i).x <= 0) {
-                    pts.erase(pts.end() - 1);
-                } else if (pts.at(i).x <= mSpeed) {
-                    pts.at(i).x = mLineWeight / 2;
-                }
-                i++;
-            }
-            float height = mPlotterRect.height - (mPlotterRect.height * ofxDatGuiScale(mVal, mMin, mMax));
-            pts.insert(pts.begin(), ofVec2f(mPlotterRect.width, height));
+            if (mPushed == false) push(toPlotY(mVal));
+            mPushed = false;
         }
     
     private:
+    
+        float toPlotY(float value)
+        {
+            return mPlotterRect.height - (mPlotterRect.height * ofxDatGuiScale(value, mMin, mMax));
+        }
+    
+        bool mPushed;
         float mVal;
         float mMin;
         float mMax;
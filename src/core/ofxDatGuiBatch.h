@@ -0,0 +1,135 @@
+/*
+    Copyright (C) 2015 Stephen Braitsch [http://braitsch.io]
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+#include "ofMain.h"
+#include "ofxSmartFont.h"
+#include "ofxDatGuiRenderer.h"
+
+/*
+    collects the solid quads of a gui panel into a single mesh with per-vertex colors.
+    components always draw their rectangles through ofxDatGuiBatch::rect, which draws
+    immediately unless a batch has been opened with begin().
+    text added through ofxSmartFont::add is batched alongside and drawn on top at end().
+*/
+
+class ofxDatGuiBatch {
+
+    public:
+
+        ofxDatGuiBatch()
+        {
+            mMesh.setMode(OF_PRIMITIVE_TRIANGLES);
+            mMesh.setUsage(GL_DYNAMIC_DRAW);
+        }
+
+        ~ofxDatGuiBatch()
+        {
+            if (mActive == this) mActive = nullptr;
+        }
+
+        void begin()
+        {
+            if (ofxDatGuiRenderer::getRenderer()->getBatching() == false) return;
+            mMesh.clear();
+            mActive = this;
+            ofxSmartFont::begin();
+        }
+
+        void end()
+        {
+            if (mActive != this) return;
+            flush();
+            mActive = nullptr;
+            ofxSmartFont::end();
+        }
+
+        static void rect(float x, float y, float w, float h, const ofColor& color)
+        {
+            if (mActive == nullptr){
+                ofxDatGuiRenderer::getRenderer()->rect(x, y, w, h, color);
+                mDrawCalls++;
+            }   else{
+                mActive->addQuad(x, y, w, h, color);
+            }
+        }
+
+        static void rect(const ofRectangle& r, const ofColor& color)
+        {
+            rect(r.x, r.y, r.width, r.height, color);
+        }
+
+    // submit any pending quads, must be called before drawing anything that isn't a solid quad //
+        static void flush()
+        {
+            if (mActive == nullptr || mActive->mMesh.getNumVertices() == 0) return;
+            ofPushStyle();
+                ofFill();
+                ofSetColor(ofColor::white);
+                mActive->mMesh.draw();
+            ofPopStyle();
+            mActive->mMesh.clear();
+            mDrawCalls++;
+        }
+
+    // also draws pending text, for components that layer quads over their own text //
+        static void flushText()
+        {
+            flush();
+            if (ofxSmartFont::isBatching()) ofxSmartFont::submit();
+        }
+
+        static bool isActive()
+        {
+            return mActive != nullptr;
+        }
+
+    // number of rectangle & mesh draw calls submitted since the last reset //
+        static int getDrawCalls()
+        {
+            return mDrawCalls;
+        }
+
+        static void resetDrawCalls()
+        {
+            mDrawCalls = 0;
+        }
+
+    private:
+
+        void addQuad(float x, float y, float w, float h, const ofFloatColor& color)
+        {
+            unsigned int i = mMesh.getNumVertices();
+            mMesh.addVertex(ofPoint(x, y));
+            mMesh.addVertex(ofPoint(x+w, y));
+            mMesh.addVertex(ofPoint(x+w, y+h));
+            mMesh.addVertex(ofPoint(x, y+h));
+            for(int j=0; j<4; j++) mMesh.addColor(color);
+            mMesh.addIndex(i); mMesh.addIndex(i+1); mMesh.addIndex(i+2);
+            mMesh.addIndex(i); mMesh.addIndex(i+2); mMesh.addIndex(i+3);
+        }
+
+        ofVboMesh mMesh;
+        static int mDrawCalls;
+        static ofxDatGuiBatch* mActive;
+
+};
@@ -23,8 +23,16 @@
 #include "ofxDatGuiComponent.h"
 
 bool ofxDatGuiLog::mQuiet = false;
+int ofxDatGuiBatch::mDrawCalls = 0;
+ofxDatGuiBatch* ofxDatGuiBatch::mActive = nullptr;
+unordered_map<uint64_t, vector<ofxDatGuiWireIndex::Entry>> ofxDatGuiWireIndex::mCells[2];
+unordered_map<ofxDatGuiComponent*, uint64_t> ofxDatGuiWireIndex::mPlaced[2];
 string ofxDatGuiTheme::AssetPath = "";
 std::unique_ptr<ofxDatGuiTheme> ofxDatGuiComponent::theme;
+bool ofxDatGuiComponent::mEventDriven = false;
+bool ofxDatGuiComponent::mPanelDrawing = false;
+vector<ofxDatGuiComponent*> ofxDatGuiComponent::mKeyTargets;
+bool ofxDatGuiComponent::mKeyRouter = false;
 
 ofxDatGuiComponent::ofxDatGuiComponent(string label)
 {
@@ -34,6 +42,7 @@ ofxDatGuiComponent::ofxDatGuiComponent(string label)
     mFocused = false;
     mMouseOver = false;
     mMouseDown = false;
+    mDirty = true;
     mStyle.opacity = 255;
     this->x = 0; this->y = 0;
     mAnchor = ofxDatGuiAnchor::NO_ANCHOR;
@@ -54,7 +63,8 @@ ofxDatGuiComponent::ofxDatGuiComponent(string label)
 ofxDatGuiComponent::~ofxDatGuiComponent()
 {
 //  cout << "ofxDatGuiComponent "<< mName << " destroyed" << endl;
-    ofRemoveListener(ofEvents().keyPressed, this, &ofxDatGuiComponent::onKeyPressed);
+    ofxDatGuiWireIndex::remove(this);
+    dropKeyTarget(this);
     ofRemoveListener(ofEvents().windowResized, this, &ofxDatGuiComponent::onWindowResized);
 }
 
@@ -121,6 +131,7 @@ void ofxDatGuiComponent::setComponentStyle(const ofxDatGuiTheme* theme)
     mLabel.color = theme->color.label;
     mLabel.margin = theme->layout.labelMargin;
     mLabel.forceUpperCase = theme->layout.upperCaseLabels;
+    mDirty = true;
     setLabel(mLabel.text);
     setWidth(theme->layout.width, theme->layout.labelWidth);
     for (int i=0; i<children.size(); i++) children[i]->setTheme(theme);
@@ -137,6 +148,7 @@ void ofxDatGuiComponent::setWidth(int width, float labelWidth)
         mLabel.width = mStyle.width * labelWidth;
     }
     mIcon.x = mStyle.width - (mStyle.width * .05) - mIcon.size;
+    mDirty = true;
     mLabel.rightAlignedXpos = mLabel.width - mLabel.margin;
     for (int i=0; i<children.size(); i++) children[i]->setWidth(width, labelWidth);
     positionLabel();
@@ -166,18 +178,29 @@ void ofxDatGuiComponent::setPosition(int x, int y)
 {
     this->x = x;
     this->y = y;
+    mDirty = true;
     for(int i=0; i<children.size(); i++) children[i]->setPosition(x, this->y + (mStyle.height+mStyle.vMargin)*(i+1));
 }
 
 void ofxDatGuiComponent::setVisible(bool visible)
 {
     mVisible = visible;
+    mDirty = true;
     if (internalEventCallback != nullptr){
         ofxDatGuiInternalEvent e(ofxDatGuiEventType::VISIBILITY_CHANGED, mIndex);
         internalEventCallback(e);
     }
 }
 
+// asks a sleeping panel to resume its per-frame updates //
+void ofxDatGuiComponent::wakePanel()
+{
+    if (internalEventCallback != nullptr){
+        ofxDatGuiInternalEvent e(ofxDatGuiEventType::PANEL_WAKE, mIndex);
+        internalEventCallback(e);
+    }
+}
+
 bool ofxDatGuiComponent::getVisible()
 {
     return mVisible;
@@ -186,12 +209,14 @@ bool ofxDatGuiComponent::getVisible()
 void ofxDatGuiComponent::setOpacity(float opacity)
 {
     mStyle.opacity = opacity * 255;
+    mDirty = true;
     for (int i=0; i<children.size(); i++) children[i]->setOpacity(opacity);
 }
 
 void ofxDatGuiComponent::setEnabled(bool enabled)
 {
     mEnabled = enabled;
+    mDirty = true;
 }
 
 bool ofxDatGuiComponent::getEnabled()
@@ -218,6 +243,33 @@ bool ofxDatGuiComponent::getMouseDown()
     return mMouseDown;
 }
 
+// true while this component or one of its children is hovered, pressed or focused //
+bool ofxDatGuiComponent::getEngaged()
+{
+    if (mMouseOver || mMouseDown || mFocused) return true;
+    for (int i=0; i<children.size(); i++) if (children[i]->getEngaged()) return true;
+    return false;
+}
+
+/*
+    dirty tracking, raised whenever the component needs to be redrawn
+*/
+
+void ofxDatGuiComponent::setDirty(bool dirty)
+{
+    mDirty = dirty;
+    if (dirty == false){
+        for (int i=0; i<children.size(); i++) children[i]->setDirty(false);
+    }
+}
+
+bool ofxDatGuiComponent::getDirty()
+{
+    if (mDirty) return true;
+    for (int i=0; i<children.size(); i++) if (children[i]->getDirty()) return true;
+    return false;
+}
+
 void ofxDatGuiComponent::setMask(const ofRectangle &mask)
 {
     mMask = mask;
@@ -239,6 +291,18 @@ bool ofxDatGuiComponent::getIsExpanded()
 	return false;
 }
 
+// true for components that mirror a variable owned by the application //
+bool ofxDatGuiComponent::getBound()
+{
+    return false;
+}
+
+// true when that variable changed since the component last synced with it //
+bool ofxDatGuiComponent::getStale()
+{
+    return false;
+}
+
 /*
     component label
 */
@@ -248,6 +312,14 @@ void ofxDatGuiComponent::setLabel(string label)
     mLabel.text = label;
     mLabel.rendered = mLabel.forceUpperCase ? ofToUpper(mLabel.text) : mLabel.rendered = mLabel.text;
     mLabel.rect = mFont->rect(mLabel.rendered);
+// cache the glyphs so the label is not laid out again on every draw //
+    if (mType != ofxDatGuiType::DROPDOWN_OPTION){
+        mLabel.drawn = mLabel.rendered;
+    }   else{
+        mLabel.drawn = "* " + mLabel.rendered;
+    }
+    mLabel.mesh = mFont->mesh(mLabel.drawn);
+    mDirty = true;
     positionLabel();
 }
 
@@ -259,6 +331,7 @@ string ofxDatGuiComponent::getLabel()
 void ofxDatGuiComponent::setLabelColor(ofColor c)
 {
     mLabel.color = c;
+    mDirty = true;
 }
 
 ofColor ofxDatGuiComponent::getLabelColor()
@@ -293,6 +366,7 @@ void ofxDatGuiComponent::positionLabel()
     }   else if (mLabel.alignment == ofxDatGuiAlignment::RIGHT){
         mLabel.x = mLabel.rightAlignedXpos - mLabel.rect.width;
     }
+    mDirty = true;
 }
 
 /*
@@ -302,16 +376,19 @@ void ofxDatGuiComponent::positionLabel()
 void ofxDatGuiComponent::setBackgroundColor(ofColor color)
 {
     mStyle.color.background = color;
+    mDirty = true;
 }
 
 void ofxDatGuiComponent::setBackgroundColorOnMouseOver(ofColor color)
 {
     mStyle.color.onMouseOver = color;
+    mDirty = true;
 }
 
 void ofxDatGuiComponent::setBackgroundColorOnMouseDown(ofColor color)
 {
     mStyle.color.onMouseDown = color;
+    mDirty = true;
 }
 
 void ofxDatGuiComponent::setBackgroundColors(ofColor c1, ofColor c2, ofColor c3)
@@ -319,27 +396,32 @@ void ofxDatGuiComponent::setBackgroundColors(ofColor c1, ofColor c2, ofColor c3)
     mStyle.color.background = c1;
     mStyle.color.onMouseOver = c2;
     mStyle.color.onMouseDown = c3;
+    mDirty = true;
 }
 
 void ofxDatGuiComponent::setStripe(ofColor color, int width)
 {
     mStyle.stripe.color = color;
     mStyle.stripe.width = width;
+    mDirty = true;
 }
 
 void ofxDatGuiComponent::setStripeColor(ofColor color)
 {
     mStyle.stripe.color = color;
+    mDirty = true;
 }
 
 void ofxDatGuiComponent::setStripeWidth(int width)
 {
     mStyle.stripe.width = width;
+    mDirty = true;
 }
 
 void ofxDatGuiComponent::setStripeVisible(bool visible)
 {
     mStyle.stripe.visible = visible;
+    mDirty = true;
 }
 
 void ofxDatGuiComponent::setBorder(ofColor color, int width)
@@ -347,11 +429,13 @@ void ofxDatGuiComponent::setBorder(ofColor color, int width)
     mStyle.border.color = color;
     mStyle.border.width = width;
     mStyle.border.visible = true;
+    mDirty = true;
 }
 
 void ofxDatGuiComponent::setBorderVisible(bool visible)
 {
     mStyle.border.visible = visible;
+    mDirty = true;
 }
 
 /*
@@ -360,37 +444,9 @@ void ofxDatGuiComponent::setBorderVisible(bool visible)
 
 void ofxDatGuiComponent::update(bool acceptEvents)
 {
-    if (acceptEvents && mEnabled && mVisible){
-        bool mp = ofGetMousePressed();
-        ofPoint mouse = ofPoint(ofGetMouseX() - mMask.x, ofGetMouseY() - mMask.y);
-        
-        mouse.x = (mouse.x - tx)/zm;
-        mouse.y = (mouse.y - ty)/zm;
-        
-        if (hitTest(mouse)){
-            if (!mMouseOver){
-                onMouseEnter(mouse);
-            }
-            if (!mMouseDown && mp){
-                onMousePress(mouse);
-                if (!mFocused) onFocus();
-            }
-        }   else{
-    // the mouse is not over the component //
-            if (mMouseOver){
-                onMouseLeave(mouse);
-            }
-            if (!mMouseDown && mp && mFocused){
-                onFocusLost();
-            }
-        }
-        if (mMouseDown) {
-            if (mp){
-                onMouseDrag(mouse);
-            }   else{
-                onMouseRelease(mouse);
-            }
-        }
+// when event driven the pointer arrives through dispatch() instead of being polled every frame //
+    if (acceptEvents && mEnabled && mVisible && mEventDriven == false){
+        route(ofPoint(ofGetMouseX(), ofGetMouseY()), ofGetMousePressed());
     }
 // don't update children unless they're visible //
     if (this->getIsExpanded()) {
@@ -404,17 +460,77 @@ void ofxDatGuiComponent::update(bool acceptEvents)
     }
 }
 
+void ofxDatGuiComponent::dispatch(ofPoint pointer, bool pressed, bool acceptEvents)
+{
+    if (acceptEvents && mEnabled && mVisible) route(pointer, pressed);
+    if (this->getIsExpanded()) {
+        for(int i=0; i<children.size(); i++) {
+            children[i]->dispatch(pointer, pressed, acceptEvents);
+            if (children[i]->getFocused()){
+                if (acceptEvents == false ) children[i]->setFocused(false);
+                acceptEvents = false;
+            }
+        }
+    }
+}
+
+void ofxDatGuiComponent::route(ofPoint pointer, bool mp)
+{
+    ofPoint mouse = ofPoint(pointer.x - mMask.x, pointer.y - mMask.y);
+    mouse.x = (mouse.x - tx)/zm;
+    mouse.y = (mouse.y - ty)/zm;
+    if (hitTest(mouse)){
+        if (!mMouseOver){
+            onMouseEnter(mouse);
+        }
+        if (!mMouseDown && mp){
+            onMousePress(mouse);
+            if (!mFocused) onFocus();
+        }
+    }   else{
+// the mouse is not over the component //
+        if (mMouseOver){
+            onMouseLeave(mouse);
+        }
+        if (!mMouseDown && mp && mFocused){
+            onFocusLost();
+        }
+    }
+    if (mMouseDown) {
+        if (mp){
+            onMouseDrag(mouse);
+        }   else{
+            onMouseRelease(mouse);
+        }
+    }
+}
+
 void ofxDatGuiComponent::draw()
 {
     ofPushStyle();
         if (mStyle.border.visible) drawBorder();
         drawBackground();
-        drawLabel();
         if (mStyle.stripe.visible) drawStripe();
+        drawLabel();
     ofPopStyle();
 }
 
+// flat level of detail used when the canvas is zoomed out, no text, icons or input fields //
+void ofxDatGuiComponent::drawReduced()
+{
+    if (!mVisible) return;
+    drawBackground();
+    if (mStyle.stripe.visible) drawStripe();
+}
+
 void ofxDatGuiComponent::drawTranslated(float transX, float transY, float zoom)
+{
+    setTranslation(transX, transY, zoom);
+    draw();
+}
+
+// the transform hit testing maps the pointer through, set without drawing //
+void ofxDatGuiComponent::setTranslation(float transX, float transY, float zoom)
 {
     tx = transX;
     ty = transY;
@@ -428,46 +544,46 @@ void ofxDatGuiComponent::drawTranslated(float transX, float transY, float zoom)
 			children[i]->zm = zoom;
         }
     }
-    draw();
+}
+
+// how far the panel has moved since this component was last positioned //
+void ofxDatGuiComponent::setPanelOffset(ofPoint offset)
+{
+    mPanelOffset = offset;
+    for(int i=0; i<children.size(); i++) children[i]->setPanelOffset(offset);
 }
 
 void ofxDatGuiComponent::drawBackground()
 {
-    ofFill();
-    ofSetColor(mStyle.color.background, mStyle.opacity);
-    ofDrawRectangle(x, y, mStyle.width, mStyle.height);
+    ofxDatGuiBatch::rect(x, y, mStyle.width, mStyle.height, ofColor(mStyle.color.background, mStyle.opacity));
 }
 
 void ofxDatGuiComponent::drawLabel()
 {
-    ofSetColor(mLabel.color);
-    if(mType == ofxDatGuiType::SLIDER)
-    {
-        ofSetColor(15);
-    }
-    if (mType != ofxDatGuiType::DROPDOWN_OPTION){
-        mFont->draw(mLabel.rendered, x+mLabel.x, y+mStyle.height/2 + mLabel.rect.height/2);
-    }   else{
-        mFont->draw("* " + mLabel.rendered, x+mLabel.x, y+mStyle.height/2 + mLabel.rect.height/2);
-    }
+    ofColor color = mType == ofxDatGuiType::SLIDER ? ofColor(15) : mLabel.color;
+    ofxDatGuiRenderer::getRenderer()->text(mFont, mLabel.drawn, &mLabel.mesh, x+mLabel.x, y+mStyle.height/2 + mLabel.rect.height/2, color);
 }
 
 void ofxDatGuiComponent::drawStripe()
 {
-    ofSetColor(mStyle.stripe.color);
-    ofDrawRectangle(x, y, mStyle.stripe.width, mStyle.height);
+    ofxDatGuiBatch::rect(x, y, mStyle.stripe.width, mStyle.height, mStyle.stripe.color);
 }
 
 void ofxDatGuiComponent::drawBorder()
 {
-    ofFill();
     int w = mStyle.border.width;
-    ofSetColor(mStyle.border.color, mStyle.opacity);
-    ofDrawRectangle(x-w, y-w, mStyle.width+(w*2), mStyle.height+(w*2));
+    ofxDatGuiBatch::rect(x-w, y-w, mStyle.width+(w*2), mStyle.height+(w*2), ofColor(mStyle.border.color, mStyle.opacity));
 }
 
 void ofxDatGuiComponent::drawColorPicker() { }
 
+void ofxDatGuiComponent::drawWireConnections()
+{
+    if (this->getIsExpanded()) {
+        for(int i=0; i<children.size(); i++) children[i]->drawWireConnections();
+    }
+}
+
 /*
     events
 */
@@ -483,34 +599,47 @@ bool ofxDatGuiComponent::hitTest(ofPoint m)
 void ofxDatGuiComponent::onMouseEnter(ofPoint m)
 {
     mMouseOver = true;
+    mDirty = true;
 }
 
 void ofxDatGuiComponent::onMouseLeave(ofPoint m)
 {
     mMouseOver = false;
+    mDirty = true;
 }
 
 void ofxDatGuiComponent::onMousePress(ofPoint m)
 {
     mMouseDown = true;
+    mDirty = true;
 }
 
 void ofxDatGuiComponent::onMouseRelease(ofPoint m)
 {
     mMouseDown = false;
+    mDirty = true;
 }
 
 void ofxDatGuiComponent::onFocus()
 {
     mFocused = true;
-    ofAddListener(ofEvents().keyPressed, this, &ofxDatGuiComponent::onKeyPressed);
+    mDirty = true;
+// a single listener forwards keys to whichever component took focus last //
+    if (mKeyRouter == false){
+        ofAddListener(ofEvents().keyPressed, &ofxDatGuiComponent::onKeyRouted);
+        mKeyRouter = true;
+    }
+// targets are stacked so a transient focus (e.g. hovering a picker) hands keys back when it ends //
+    dropKeyTarget(this);
+    mKeyTargets.push_back(this);
 }
 
 void ofxDatGuiComponent::onFocusLost()
 {
     mFocused = false;
     mMouseDown = false;
-    ofRemoveListener(ofEvents().keyPressed, this, &ofxDatGuiComponent::onKeyPressed);
+    mDirty = true;
+    dropKeyTarget(this);
 }
 
 void ofxDatGuiComponent::onKeyPressed(int key) { }
@@ -519,12 +648,23 @@ void ofxDatGuiComponent::onMouseDrag(ofPoint m) { }
 void ofxDatGuiComponent::onKeyPressed(ofKeyEventArgs &e)
 {
     onKeyPressed(e.key);
+    mDirty = true;
     if ((e.key == OF_KEY_RETURN || e.key == OF_KEY_TAB)){
         onFocusLost();
-        ofRemoveListener(ofEvents().keyPressed, this, &ofxDatGuiComponent::onKeyPressed);
+        dropKeyTarget(this);
     }
 }
 
+void ofxDatGuiComponent::onKeyRouted(ofKeyEventArgs &e)
+{
+    if (mKeyTargets.size() > 0) mKeyTargets.back()->onKeyPressed(e);
+}
+
+void ofxDatGuiComponent::dropKeyTarget(ofxDatGuiComponent* target)
+{
+    mKeyTargets.erase(std::remove(mKeyTargets.begin(), mKeyTargets.end(), target), mKeyTargets.end());
+}
+
 void ofxDatGuiComponent::onWindowResized()
 {
     if (mAnchor == ofxDatGuiAnchor::TOP_LEFT){
@@ -541,6 +681,7 @@ void ofxDatGuiComponent::onWindowResized(ofResizeEventArgs &e)
 
 ofxDatGuiComponent * ofxDatGuiComponent::toggleMidiMode(){
     midiMode = !midiMode;
+    mDirty = true;
     return this;
 }
 
@@ -552,6 +693,7 @@ bool ofxDatGuiComponent::getMidiMode()
 void ofxDatGuiComponent::toggleMidiMap(bool mm)
 {
     midiMap = mm;
+    mDirty = true;
 }
 
 bool ofxDatGuiComponent::getMidiMap()
@@ -563,6 +705,7 @@ bool ofxDatGuiComponent::getMidiMap()
 void ofxDatGuiComponent::setMappingString(string mapping)
 {
     mappingString = mapping;
+    mDirty = true;
 }
 
 string ofxDatGuiComponent::getMappingString()
@@ -609,10 +752,10 @@ DKWireConnection * ofxDatGuiComponent::getOutputConnection(int x, int y)
 
 ofPoint ofxDatGuiComponent::getInput()
 {
-    return outputConnection->getWireConnectionPos();
+    return outputConnection->getWireConnectionPos() + mPanelOffset;
 }
 
 ofPoint ofxDatGuiComponent::getOutput()
 {
-    return inputConnection->getWireConnectionPos();
+    return inputConnection->getWireConnectionPos() + mPanelOffset;
 }
@@ -22,6 +22,8 @@
 
 #pragma once
 #include "ofxDatGuiIntObject.h"
+#include "ofxDatGuiBatch.h"
+#include "ofxDatGuiWireIndex.h"
 #include "DKWireConnection.hpp"
 
 class ofxDatGuiComponent : public ofxDatGuiInteractiveObject
@@ -67,7 +69,11 @@ class ofxDatGuiComponent : public ofxDatGuiInteractiveObject
         void    setFocused(bool focused);
         bool    getFocused();
         void    setOpacity(float opacity);
+        void    setDirty(bool dirty);
+        bool    getDirty();
         bool    getMouseDown();
+        bool    getEngaged();
+        void    wakePanel();
         ofxDatGuiType getType();
     
         vector<ofxDatGuiComponent*> children;
@@ -84,9 +90,13 @@ class ofxDatGuiComponent : public ofxDatGuiInteractiveObject
         DKWireConnection * getOutputConnection(int, int);
     
         virtual void draw();
+        virtual void drawReduced();
         void drawTranslated(float, float, float);
         void drawTranslated();
+        void setTranslation(float transX, float transY, float zoom);
+        void setPanelOffset(ofPoint offset);
         virtual void update(bool acceptEvents = true);
+        void dispatch(ofPoint pointer, bool pressed, bool acceptEvents = true);
         virtual bool hitTest(ofPoint m);
 
         virtual void setPosition(int x, int y);
@@ -97,7 +107,10 @@ class ofxDatGuiComponent : public ofxDatGuiInteractiveObject
         virtual int  getWidth();
         virtual int  getHeight();
         virtual bool getIsExpanded();
+        virtual bool getBound();
+        virtual bool getStale();
         virtual void drawColorPicker();
+        virtual void drawWireConnections();
 
         virtual void onFocus();
         virtual void onFocusLost();
@@ -140,11 +153,23 @@ class ofxDatGuiComponent : public ofxDatGuiInteractiveObject
         bool mEnabled;
         bool mMouseOver;
         bool mMouseDown;
+        bool mDirty;
         ofRectangle mMask;
+        ofPoint mPanelOffset;
         ofxDatGuiType mType;
         ofxDatGuiAnchor mAnchor;
         shared_ptr<ofxSmartFont> mFont;
     
+    // set by an event driven panel while it updates its own components //
+        static bool mEventDriven;
+    // set while a panel draws its components, the panel draws their wires afterwards //
+        static bool mPanelDrawing;
+        friend class ofxDatGui;
+        static vector<ofxDatGuiComponent*> mKeyTargets;
+        static bool mKeyRouter;
+        static void dropKeyTarget(ofxDatGuiComponent* target);
+        static void onKeyRouted(ofKeyEventArgs &e);
+    
         bool midiMode;
         bool midiMap;
         string mappingString;
@@ -178,12 +203,14 @@ class ofxDatGuiComponent : public ofxDatGuiInteractiveObject
             int x;
             string text;
             string rendered;
+            string drawn;
             bool visible;
             ofColor color;
             float width;
             int margin;
             int rightAlignedXpos;
             ofRectangle rect;
+            ofMesh mesh;
             bool forceUpperCase;
             ofxDatGuiAlignment alignment;
         } mLabel;
@@ -206,5 +233,7 @@ class ofxDatGuiComponent : public ofxDatGuiInteractiveObject
     
         static unique_ptr<ofxDatGuiTheme> theme;
     
+        void route(ofPoint pointer, bool pressed);
+    
 };
 
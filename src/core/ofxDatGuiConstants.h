@@ -39,6 +39,13 @@ enum class ofxDatGuiGraph
     OUTLINE,
 };
 
+enum class ofxDatGuiDetail
+{
+    FULL = 0,
+    REDUCED,
+    MINIMAL
+};
+
 enum class ofxDatGuiAlignment
 {
     LEFT = 1,
@@ -43,7 +43,8 @@ enum ofxDatGuiEventType
     OPTION_SELECTED,
     DROPDOWN_TOGGLED,
     VISIBILITY_CHANGED,
-    MATRIX_BUTTON_TOGGLED
+    MATRIX_BUTTON_TOGGLED,
+    PANEL_WAKE
 };
 
 class ofxDatGuiInternalEvent{
@@ -0,0 +1,89 @@
+/*
+    Copyright (C) 2015 Stephen Braitsch [http://braitsch.io]
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+#include "ofMain.h"
+#include <charconv>
+
+/*
+    fixed point number formatting for sliders that writes into a caller owned buffer.
+    values are scaled by a power of ten and printed as integers so nothing is allocated
+    and no floating point to string conversion is needed.
+*/
+
+class ofxDatGuiFormat {
+
+    public:
+    
+        static const int MAX_PRECISION = 4;
+    // large enough for a sign, the 39 integer digits of FLT_MAX, the point and MAX_PRECISION decimals //
+        static const int BUFFER_SIZE = 48;
+
+        static double round(double value, int precision)
+        {
+            return std::round(value * Pow10[precision]) / Pow10[precision];
+        }
+
+    // writes value rounded to precision decimals and returns the number of chars written.
+    // pad keeps trailing zeros so every value has exactly precision decimals //
+        static int fixed(char* out, double value, int precision, bool pad)
+        {
+            double scaled = std::round(value * Pow10[precision]);
+        // beyond what fits in an integer fall back to the c library, which returns the untruncated length //
+            if (!(std::fabs(scaled) < 1e18)){
+                int n = snprintf(out, BUFFER_SIZE, "%.*f", precision, value);
+                return std::max(0, std::min(n, BUFFER_SIZE - 1));
+            }
+            long long n = (long long)scaled;
+            char* p = out;
+            if (n < 0){
+                *p++ = '-';
+                n = -n;
+            }
+            long long whole = n / Pow10i[precision];
+            long long fraction = n % Pow10i[precision];
+            p = std::to_chars(p, out + BUFFER_SIZE, whole).ptr;
+            int digits = precision;
+            if (pad == false){
+                while (digits > 0 && fraction % 10 == 0){
+                    fraction /= 10;
+                    digits--;
+                }
+            }
+            if (digits > 0){
+                *p++ = '.';
+                for (int i=digits-1; i>=0; i--){
+                    p[i] = '0' + fraction % 10;
+                    fraction /= 10;
+                }
+                p += digits;
+            }
+            *p = '\0';
+            return p - out;
+        }
+
+    private:
+    
+        static constexpr double Pow10[MAX_PRECISION + 1] = {1, 10, 100, 1000, 10000};
+        static constexpr long long Pow10i[MAX_PRECISION + 1] = {1, 10, 100, 1000, 10000};
+
+};
@@ -29,6 +29,8 @@ namespace ofxDatGuiMsg
 {
     const string EVENT_HANDLER_NULL = "[WARNING] :: Event Handler Not Set";
     const string COMPONENT_NOT_FOUND = "[ERROR] :: Component Not Found";
+    const string DROPDOWN_NOT_SEARCHABLE = "[WARNING] :: Dropdown Is Not Searchable";
+    const string LIST_VIRTUALIZED = "[WARNING] :: Not Supported By A List Backed By A Data Source";
 }
 
 class ofxDatGuiLog {
@@ -0,0 +1,147 @@
+/*
+    Copyright (C) 2015 Stephen Braitsch [http://braitsch.io]
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+
+#include "ofxDatGuiRenderer.h"
+#include "ofxDatGuiBatch.h"
+
+shared_ptr<ofxDatGuiRenderer> ofxDatGuiRenderer::mRenderer = make_shared<ofxDatGuiGLRenderer>();
+
+void ofxDatGuiRenderer::setRenderer(shared_ptr<ofxDatGuiRenderer> renderer)
+{
+    mRenderer = renderer == nullptr ? make_shared<ofxDatGuiGLRenderer>() : renderer;
+}
+
+/*
+    openFrameworks renderer, anything that isn't a solid quad first submits the pending batch
+*/
+
+void ofxDatGuiGLRenderer::rect(float x, float y, float w, float h, const ofColor& color)
+{
+    ofFill();
+    ofSetColor(color);
+    ofDrawRectangle(x, y, w, h);
+}
+
+void ofxDatGuiGLRenderer::line(float x1, float y1, float x2, float y2, const ofColor& color, float weight)
+{
+    ofxDatGuiBatch::flush();
+    ofSetLineWidth(weight);
+    ofSetColor(color);
+    ofDrawLine(x1, y1, x2, y2);
+}
+
+void ofxDatGuiGLRenderer::circle(float x, float y, float radius, const ofColor& color)
+{
+    ofxDatGuiBatch::flush();
+    ofFill();
+    ofSetColor(color);
+    ofDrawCircle(x, y, radius);
+}
+
+void ofxDatGuiGLRenderer::image(const shared_ptr<ofImage>& image, float x, float y, float w, float h, const ofColor& color)
+{
+    ofxDatGuiBatch::flush();
+    ofSetColor(color);
+    image->draw(x, y, w, h);
+}
+
+void ofxDatGuiGLRenderer::text(const shared_ptr<ofxSmartFont>& font, const string& s, const ofMesh* glyphs, float x, float y, const ofColor& color)
+{
+    if (glyphs != nullptr){
+        font->add(*glyphs, x, y, color);
+    }   else{
+        font->add(s, x, y, color);
+    }
+}
+
+void ofxDatGuiGLRenderer::custom(const string& /*name*/, const ofRectangle& /*bounds*/, const function<void()>& draw)
+{
+    ofxDatGuiBatch::flush();
+    draw();
+}
+
+bool ofxDatGuiGLRenderer::getBatching()
+{
+    return true;
+}
+
+/*
+    recording renderer
+*/
+
+void ofxDatGuiRecordingRenderer::rect(float x, float y, float w, float h, const ofColor& color)
+{
+    record(ofxDatGuiDrawType::RECT, ofRectangle(x, y, w, h), color);
+}
+
+void ofxDatGuiRecordingRenderer::line(float x1, float y1, float x2, float y2, const ofColor& color, float /*weight*/)
+{
+    record(ofxDatGuiDrawType::LINE, ofRectangle(x1, y1, x2 - x1, y2 - y1), color);
+}
+
+void ofxDatGuiRecordingRenderer::circle(float x, float y, float radius, const ofColor& color)
+{
+    record(ofxDatGuiDrawType::CIRCLE, ofRectangle(x, y, radius, radius), color);
+}
+
+void ofxDatGuiRecordingRenderer::image(const shared_ptr<ofImage>& /*image*/, float x, float y, float w, float h, const ofColor& color)
+{
+    record(ofxDatGuiDrawType::IMAGE, ofRectangle(x, y, w, h), color);
+}
+
+void ofxDatGuiRecordingRenderer::text(const shared_ptr<ofxSmartFont>& /*font*/, const string& s, const ofMesh* /*glyphs*/, float x, float y, const ofColor& color)
+{
+    record(ofxDatGuiDrawType::TEXT, ofRectangle(x, y, 0, 0), color, s);
+}
+
+void ofxDatGuiRecordingRenderer::custom(const string& name, const ofRectangle& bounds, const function<void()>& /*draw*/)
+{
+    record(ofxDatGuiDrawType::CUSTOM, bounds, ofColor::white, name);
+}
+
+bool ofxDatGuiRecordingRenderer::getBatching()
+{
+    return false;
+}
+
+void ofxDatGuiRecordingRenderer::clear()
+{
+    mCommands.clear();
+}
+
+int ofxDatGuiRecordingRenderer::count(ofxDatGuiDrawType type)
+{
+    int n = 0;
+    for(auto& c:mCommands) if (c.type == type) n++;
+    return n;
+}
+
+const vector<ofxDatGuiDrawCommand>& ofxDatGuiRecordingRenderer::getCommands()
+{
+    return mCommands;
+}
+
+void ofxDatGuiRecordingRenderer::record(ofxDatGuiDrawType type, const ofRectangle& bounds, const ofColor& color, const string& text)
+{
+    mCommands.push_back({type, bounds, color, text});
+}
@@ -0,0 +1,124 @@
+/*
+    Copyright (C) 2015 Stephen Braitsch [http://braitsch.io]
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+
+#pragma once
+#include "ofMain.h"
+#include "ofxSmartFont.h"
+
+/*
+    every primitive a component draws goes through the current renderer. the default renderer
+    draws with openFrameworks, ofxDatGuiRecordingRenderer captures the calls instead so the
+    draw path can be inspected & timed without a gpu.
+*/
+
+class ofxDatGuiRenderer {
+
+    public:
+    
+        virtual ~ofxDatGuiRenderer(){}
+    
+        virtual void rect(float x, float y, float w, float h, const ofColor& color) = 0;
+        virtual void line(float x1, float y1, float x2, float y2, const ofColor& color, float weight = 1) = 0;
+        virtual void circle(float x, float y, float radius, const ofColor& color) = 0;
+        virtual void image(const shared_ptr<ofImage>& image, float x, float y, float w, float h, const ofColor& color) = 0;
+    
+    // glyphs is an optional prebuilt mesh of the string laid out at the origin //
+        virtual void text(const shared_ptr<ofxSmartFont>& font, const string& s, const ofMesh* glyphs, float x, float y, const ofColor& color) = 0;
+    
+    // geometry a component draws itself (vbos, meshes, fbos), bounds describe the area it covers //
+        virtual void custom(const string& name, const ofRectangle& bounds, const function<void()>& draw) = 0;
+    
+    // whether quads & text may be collected into ofxDatGuiBatch meshes //
+        virtual bool getBatching() = 0;
+    
+        static void setRenderer(shared_ptr<ofxDatGuiRenderer> renderer);
+        static ofxDatGuiRenderer* getRenderer()
+        {
+            return mRenderer.get();
+        }
+    
+    private:
+    
+        static shared_ptr<ofxDatGuiRenderer> mRenderer;
+
+};
+
+class ofxDatGuiGLRenderer : public ofxDatGuiRenderer {
+
+    public:
+    
+        void rect(float x, float y, float w, float h, const ofColor& color);
+        void line(float x1, float y1, float x2, float y2, const ofColor& color, float weight = 1);
+        void circle(float x, float y, float radius, const ofColor& color);
+        void image(const shared_ptr<ofImage>& image, float x, float y, float w, float h, const ofColor& color);
+        void text(const shared_ptr<ofxSmartFont>& font, const string& s, const ofMesh* glyphs, float x, float y, const ofColor& color);
+        void custom(const string& name, const ofRectangle& bounds, const function<void()>& draw);
+        bool getBatching();
+
+};
+
+enum class ofxDatGuiDrawType
+{
+    RECT = 0,
+    LINE,
+    CIRCLE,
+    IMAGE,
+    TEXT,
+    CUSTOM
+};
+
+/*
+    a recorded draw call, lines store their start point in bounds.x/y and their delta
+    in bounds.width/height, circles store their center in x/y & their radius as the width
+*/
+
+struct ofxDatGuiDrawCommand {
+    ofxDatGuiDrawType type;
+    ofRectangle bounds;
+    ofColor color;
+    string text;
+};
+
+class ofxDatGuiRecordingRenderer : public ofxDatGuiRenderer {
+
+    public:
+    
+        void rect(float x, float y, float w, float h, const ofColor& color);
+        void line(float x1, float y1, float x2, float y2, const ofColor& color, float weight = 1);
+        void circle(float x, float y, float radius, const ofColor& color);
+        void image(const shared_ptr<ofImage>& image, float x, float y, float w, float h, const ofColor& color);
+        void text(const shared_ptr<ofxSmartFont>& font, const string& s, const ofMesh* glyphs, float x, float y, const ofColor& color);
+        void custom(const string& name, const ofRectangle& bounds, const function<void()>& draw);
+        bool getBatching();
+    
+    // clearing keeps the buffer's capacity so repeated frames don't allocate //
+        void clear();
+        int count(ofxDatGuiDrawType type);
+        const vector<ofxDatGuiDrawCommand>& getCommands();
+    
+    private:
+    
+        void record(ofxDatGuiDrawType type, const ofRectangle& bounds, const ofColor& color, const string& text = "");
+        vector<ofxDatGuiDrawCommand> mCommands;
+
+};
@@ -0,0 +1,111 @@
+/*
+    Copyright (C) 2015 Stephen Braitsch [http://braitsch.io]
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#pragma once
+#include "ofMain.h"
+
+class ofxDatGuiComponent;
+
+/*
+    spatial hash of every wire connector in the application keyed by its position.
+    cells are as wide as the pick radius so a point query only has to look at the
+    3x3 block of cells around it.
+*/
+
+class ofxDatGuiWireIndex {
+
+    public:
+    
+        enum Connector { INPUT = 0, OUTPUT = 1 };
+        static const int Radius = 15;
+
+        static void place(ofxDatGuiComponent* c, Connector type, ofPoint pos)
+        {
+            remove(c, type);
+            uint64_t key = getCellKey(getCell(pos.x), getCell(pos.y));
+            mCells[type][key].push_back({c, pos});
+            mPlaced[type][c] = key;
+        }
+    
+        static void remove(ofxDatGuiComponent* c, Connector type)
+        {
+            auto placed = mPlaced[type].find(c);
+            if (placed == mPlaced[type].end()) return;
+            auto cell = mCells[type].find(placed->second);
+            if (cell != mCells[type].end()){
+                vector<Entry>& v = cell->second;
+                v.erase(std::remove_if(v.begin(), v.end(), [c](const Entry& e){ return e.component == c; }), v.end());
+                if (v.empty()) mCells[type].erase(cell);
+            }
+            mPlaced[type].erase(placed);
+        }
+    
+        static void remove(ofxDatGuiComponent* c)
+        {
+            remove(c, INPUT);
+            remove(c, OUTPUT);
+        }
+    
+    // nearest connector strictly inside the pick radius that passes the optional filter //
+        static ofxDatGuiComponent* nearest(Connector type, int x, int y, function<bool(ofxDatGuiComponent*)> accept = nullptr)
+        {
+            ofxDatGuiComponent* hit = nullptr;
+            float closest = Radius * Radius;
+            int cx = getCell(x);
+            int cy = getCell(y);
+            for (int i=cx-1; i<=cx+1; i++){
+                for (int j=cy-1; j<=cy+1; j++){
+                    auto cell = mCells[type].find(getCellKey(i, j));
+                    if (cell == mCells[type].end()) continue;
+                    for (auto &e:cell->second){
+                        float d = (e.pos.x - x) * (e.pos.x - x) + (e.pos.y - y) * (e.pos.y - y);
+                        if (d < closest && (accept == nullptr || accept(e.component))){
+                            closest = d;
+                            hit = e.component;
+                        }
+                    }
+                }
+            }
+            return hit;
+        }
+
+    private:
+    
+        struct Entry {
+            ofxDatGuiComponent* component;
+            ofPoint pos;
+        };
+    
+        static unordered_map<uint64_t, vector<Entry>> mCells[2];
+        static unordered_map<ofxDatGuiComponent*, uint64_t> mPlaced[2];
+    
+        static int getCell(float v)
+        {
+            return floor(v / Radius);
+        }
+    
+        static uint64_t getCellKey(int cx, int cy)
+        {
+            return ((uint64_t)(uint32_t)cx << 32) | (uint32_t)cy;
+        }
+
+};
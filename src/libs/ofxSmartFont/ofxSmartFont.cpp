@@ -26,6 +26,12 @@ using namespace std;
 
 #include "ofxSmartFont.h"
 vector<shared_ptr<ofxSmartFont>> ofxSmartFont::mFonts;
+bool ofxSmartFont::mBatching = false;
+bool ofxSmartFont::mSharedAtlas = false;
+bool ofxSmartFont::mAtlasInvalid = true;
+int ofxSmartFont::mTextureBinds = 0;
+float ofxSmartFont::mAtlasUsed = 0;
+weak_ptr<ofxSmartFont::Atlas> ofxSmartFont::mSharedPages;
 
 /*
     instance methods
@@ -36,6 +42,90 @@ void ofxSmartFont::draw(string s, int x, int y)
     ttf.drawString(s, x, y);
 }
 
+void ofxSmartFont::add(const string& s, int x, int y, const ofColor& color)
+{
+    if (mBatching == false){
+        ofSetColor(color);
+        ttf.drawString(s, x, y);
+        mTextureBinds++;
+        return;
+    }
+    append(ttf.getStringMesh(s, 0, 0, ofIsVFlipped()), x, y, color);
+}
+
+void ofxSmartFont::add(const ofMesh& glyphs, int x, int y, const ofColor& color)
+{
+    if (mBatching == false){
+        ofSetColor(color);
+        ofPushMatrix();
+        ofTranslate(x, y);
+        ttf.getFontTexture().bind();
+        glyphs.draw();
+        ttf.getFontTexture().unbind();
+        ofPopMatrix();
+        mTextureBinds++;
+        return;
+    }
+    append(glyphs, x, y, color);
+}
+
+// draw a prebuilt mesh of glyphs that carries its own vertex colors //
+void ofxSmartFont::draw(const ofMesh& glyphs)
+{
+    ttf.getFontTexture().bind();
+    glyphs.draw();
+    ttf.getFontTexture().unbind();
+    mTextureBinds++;
+}
+
+/*
+    returns a copy of the glyph quads for a string laid out at the origin,
+    components cache these and hand them back to add() each frame
+*/
+
+ofMesh ofxSmartFont::mesh(const string& s)
+{
+    return ttf.getStringMesh(s, 0, 0, ofIsVFlipped());
+}
+
+/*
+    append glyph quads offset by x & y to this font's batch, or to its atlas page's batch
+    with the texture coordinates remapped into the page
+*/
+
+void ofxSmartFont::append(const ofMesh& glyphs, int x, int y, const ofColor& color)
+{
+    bool atlas = mSharedAtlas && mAtlas != nullptr && mAtlasPage >= 0;
+    ofVboMesh& batch = atlas ? mAtlas->batches[mAtlasPage] : mBatch;
+    unsigned int offset = batch.getNumVertices();
+    ofDefaultVertexType origin(x, y, 0);
+    for(auto& v:glyphs.getVertices()) batch.addVertex(v + origin);
+    if (atlas){
+        float pw = mAtlas->pages[mAtlasPage].getWidth();
+        float ph = mAtlas->pages[mAtlasPage].getHeight();
+        for(auto& t:glyphs.getTexCoords()){
+            batch.addTexCoord(ofDefaultTexCoordType((mAtlasRect.x + t.x * mAtlasRect.width) / pw, (mAtlasRect.y + t.y * mAtlasRect.height) / ph));
+        }
+    }   else{
+        batch.addTexCoords(glyphs.getTexCoords());
+    }
+    for(int i=0; i<glyphs.getNumVertices(); i++) batch.addColor(color);
+    for(auto i:glyphs.getIndices()) batch.addIndex(offset + i);
+}
+
+void ofxSmartFont::flush()
+{
+    if (mBatch.getNumVertices() == 0) return;
+    ofPushStyle();
+        ofSetColor(ofColor::white);
+        ttf.getFontTexture().bind();
+        mBatch.draw();
+        ttf.getFontTexture().unbind();
+    ofPopStyle();
+    mBatch.clear();
+    mTextureBinds++;
+}
+
 string ofxSmartFont::name()
 {
     return mName;
@@ -92,6 +182,8 @@ shared_ptr<ofxSmartFont> ofxSmartFont::add(string file, int size, string name)
         make_shared_sf(string file, int size, string name) : ofxSmartFont(file, size, name){}
     };
     mFonts.push_back(make_shared<make_shared_sf>(file, size, name));
+// repack on the next begin() so fonts added after the first pack join the shared atlas //
+    mAtlasInvalid = true;
     return mFonts.back();
 }
 
@@ -133,6 +225,149 @@ shared_ptr<ofxSmartFont> ofxSmartFont::get(vector<string> keys, int size)
     return nullptr;
 }
 
+void ofxSmartFont::begin()
+{
+    if (mSharedAtlas && mAtlasInvalid) packAtlas();
+    mBatching = true;
+}
+
+void ofxSmartFont::end()
+{
+    mBatching = false;
+    submit();
+}
+
+void ofxSmartFont::submit()
+{
+    shared_ptr<Atlas> atlas = mSharedPages.lock();
+    for(int i=0; atlas != nullptr && i<atlas->batches.size(); i++){
+        if (atlas->batches[i].getNumVertices() == 0) continue;
+        ofPushStyle();
+            ofSetColor(ofColor::white);
+            atlas->pages[i].bind();
+            atlas->batches[i].draw();
+            atlas->pages[i].unbind();
+        ofPopStyle();
+        atlas->batches[i].clear();
+        mTextureBinds++;
+    }
+    for(auto f:mFonts) f->flush();
+}
+
+void ofxSmartFont::setSharedAtlas(bool shared)
+{
+#ifdef TARGET_OPENGLES
+// packing reads the glyph textures back with glGetTexImage which OpenGL ES doesn't have //
+    if (shared){
+        log("shared atlas is not supported on OpenGL ES, fonts keep their own textures");
+        return;
+    }
+#endif
+    mSharedAtlas = shared;
+    mAtlasInvalid = true;
+    if (mSharedAtlas == false){
+        for(auto f:mFonts){
+            f->mAtlas = nullptr;
+            f->mAtlasPage = -1;
+        }
+    }
+}
+
+bool ofxSmartFont::getSharedAtlas()
+{
+    return mSharedAtlas;
+}
+
+int ofxSmartFont::getAtlasPages()
+{
+    shared_ptr<Atlas> atlas = mSharedPages.lock();
+    return atlas != nullptr ? atlas->pages.size() : 0;
+}
+
+// fraction of the atlas pages covered by font glyph textures //
+float ofxSmartFont::getAtlasOccupancy()
+{
+    float area = 0;
+    shared_ptr<Atlas> atlas = mSharedPages.lock();
+    if (atlas != nullptr) for(auto& p:atlas->pages) area += p.getWidth() * p.getHeight();
+    return area > 0 ? mAtlasUsed / area : 0;
+}
+
+// number of texture binds made to draw text since the last reset //
+int ofxSmartFont::getTextureBinds()
+{
+    return mTextureBinds;
+}
+
+void ofxSmartFont::resetTextureBinds()
+{
+    mTextureBinds = 0;
+}
+
+/*
+    shelf packs each font's glyph texture into the atlas pages, tallest first. a font whose
+    pixels can't share a page (different channel count) keeps drawing from its own texture
+*/
+
+void ofxSmartFont::packAtlas()
+{
+    vector<shared_ptr<ofxSmartFont>> fonts = mFonts;
+    vector<ofPixels> pixels(fonts.size());
+    for(int i=0; i<fonts.size(); i++) fonts[i]->ttf.getFontTexture().readToPixels(pixels[i]);
+    vector<int> order(fonts.size());
+    for(int i=0; i<order.size(); i++) order[i] = i;
+    sort(order.begin(), order.end(), [&](int a, int b){ return pixels[a].getHeight() > pixels[b].getHeight(); });
+    vector<ofPixels> pages;
+    int shelfX = 0, shelfY = 0, shelfH = 0;
+    mAtlasUsed = 0;
+    for(auto i:order){
+        ofPixels& px = pixels[i];
+        int w = px.getWidth();
+        int h = px.getHeight();
+        fonts[i]->mAtlas = nullptr;
+        fonts[i]->mAtlasPage = -1;
+        if (w == 0 || h == 0) continue;
+        if (pages.size() > 0 && shelfX + w > pages.back().getWidth()){
+            shelfX = 0;
+            shelfY += shelfH;
+            shelfH = 0;
+        }
+        if (pages.size() == 0 || shelfY + h > pages.back().getHeight() || w > pages.back().getWidth()){
+            int size = max(int(ATLAS_PAGE_SIZE), max(w, h));
+            pages.push_back(ofPixels());
+            pages.back().allocate(size, size, px.getNumChannels());
+            pages.back().set(0);
+            shelfX = shelfY = shelfH = 0;
+        }
+        if (px.getNumChannels() != pages.back().getNumChannels()) continue;
+        px.pasteInto(pages.back(), shelfX, shelfY);
+        fonts[i]->mAtlasPage = pages.size() - 1;
+        fonts[i]->mAtlasRect = ofRectangle(shelfX, shelfY, w, h);
+        shelfX += w;
+        shelfH = max(shelfH, h);
+        mAtlasUsed += w * h;
+    }
+    shared_ptr<Atlas> atlas = make_shared<Atlas>();
+    atlas->pages.resize(pages.size());
+    atlas->batches.resize(pages.size());
+    for(int i=0; i<pages.size(); i++){
+    // glyph texcoords are remapped into normalized page space so the pages must not be rectangle textures //
+        atlas->pages[i].allocate(pages[i], false);
+        atlas->pages[i].loadData(pages[i]);
+        if (pages[i].getNumChannels() == 2) atlas->pages[i].setRGToRGBASwizzles(true);
+        atlas->batches[i].setMode(OF_PRIMITIVE_TRIANGLES);
+        atlas->batches[i].setUsage(GL_DYNAMIC_DRAW);
+    }
+    for(auto f:fonts) if (f->mAtlasPage >= 0) f->mAtlas = atlas;
+    mSharedPages = atlas;
+    mAtlasInvalid = false;
+}
+
+bool ofxSmartFont::isBatching()
+{
+    return mBatching;
+}
+
 void ofxSmartFont::list()
 {
     log("----------------------------------");
@@ -39,6 +39,10 @@ class ofxSmartFont {
         string name();
         void name(string name);
         void draw(string s, int x, int y);
+        void add(const string& s, int x, int y, const ofColor& color);
+        void add(const ofMesh& glyphs, int x, int y, const ofColor& color);
+        void draw(const ofMesh& glyphs);
+        ofMesh mesh(const string& s);
     
         ofRectangle rect(string s, int x=0, int y=0);
         float width(string s, int x=0, int y=0);
@@ -54,6 +58,26 @@ class ofxSmartFont {
         static shared_ptr<ofxSmartFont> get(vector<string> keys, int size);
         static void list();
     
+    /*
+        text batching, strings added between begin & end are drawn with one call per font
+    */
+        static void begin();
+        static void end();
+    // draws the text added so far without ending the batch //
+        static void submit();
+        static bool isBatching();
+    
+    /*
+        shared atlas, packs the glyph textures of every registered font into one set of texture
+        pages so batched text from different fonts & sizes is drawn with one bind per page
+    */
+        static void setSharedAtlas(bool shared);
+        static bool getSharedAtlas();
+        static int getAtlasPages();
+        static float getAtlasOccupancy();
+        static int getTextureBinds();
+        static void resetTextureBinds();
+    
         static vector<shared_ptr<ofxSmartFont>> mFonts;
     
     private:
@@ -72,14 +96,36 @@ class ofxSmartFont {
             }   else{
                 log("new font added : " +mName+" @ pt size "+std::to_string(mSize));
             }
+            mBatch.setMode(OF_PRIMITIVE_TRIANGLES);
+            mBatch.setUsage(GL_DYNAMIC_DRAW);
+            mAtlasPage = -1;
         }
     
         static void log(string msg);
+        void flush();
+        void append(const ofMesh& glyphs, int x, int y, const ofColor& color);
+        static void packAtlas();
 
         int mSize;
         string mFile;
         string mName;
         ofTrueTypeFont ttf;
+        ofVboMesh mBatch;
+    // atlas pages are owned by the fonts packed into them so they're released along with the fonts //
+        struct Atlas {
+            vector<ofTexture> pages;
+            vector<ofVboMesh> batches;
+        };
+        shared_ptr<Atlas> mAtlas;
+        int mAtlasPage;
+        ofRectangle mAtlasRect;
+        static bool mBatching;
+        static bool mSharedAtlas;
+        static bool mAtlasInvalid;
+        static int mTextureBinds;
+        static float mAtlasUsed;
+        static weak_ptr<Atlas> mSharedPages;
+        static const int ATLAS_PAGE_SIZE = 2048;
     
 };
 
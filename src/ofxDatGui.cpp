@@ -23,7 +23,10 @@
 #include "ofxDatGui.h"
 
 ofxDatGui* ofxDatGui::mActiveGui;
-vector<ofxDatGui*> ofxDatGui::mGuis;
+ofxDatGuiCompositor ofxDatGui::mCompositor;
+ofRectangle ofxDatGui::mViewport;
+ofxDatGuiCullStats ofxDatGui::mCullStats;
+uint64_t ofxDatGui::mCullFrame = 0;
 
 ofxDatGui::ofxDatGui(int x, int y)
 {
@@ -49,10 +52,11 @@ ofxDatGui::ofxDatGui(ofxDatGuiAnchor anchor)
 ofxDatGui::~ofxDatGui()
 {
     for (auto i:items) delete i;
-    mGuis.erase(std::remove(mGuis.begin(), mGuis.end(), this), mGuis.end());
-    if (mActiveGui == this) mActiveGui = mGuis.size() > 0 ? mGuis[0] : nullptr;
-    ofRemoveListener(ofEvents().draw, this, &ofxDatGui::onDraw, OF_EVENT_ORDER_AFTER_APP + mIndex);
-    ofRemoveListener(ofEvents().update, this, &ofxDatGui::onUpdate, OF_EVENT_ORDER_BEFORE_APP - mIndex);
+    if (mAutoDraw) mCompositor.setAutoDraw(false);
+    if (mEventDriven) mCompositor.setEventDriven(false);
+    mCompositor.unindex(this);
+    mCompositor.remove(mZ);
+    if (mActiveGui == this) mActiveGui = mCompositor.getGuis().size() > 0 ? mCompositor.getGuis().back() : nullptr;
     ofRemoveListener(ofEvents().windowResized, this, &ofxDatGui::onWindowResized, OF_EVENT_ORDER_BEFORE_APP);
 }
 
@@ -68,6 +72,21 @@ void ofxDatGui::init()
     mWidthChanged = false;
     mThemeChanged = false;
     mAlignmentChanged = false;
+    mBatchRendering = false;
+    mRetainedMode = false;
+    mReducedZoom = 0.5f;
+    mMinimalZoom = 0.25f;
+    mCacheInvalid = true;
+    mCacheZoom = 1;
+    mItemTX = 0;
+    mItemTY = 0;
+    mItemZoom = 1;
+    mItemsTranslated = false;
+    mSleeping = false;
+    mAutoSleep = false;
+    mEventDriven = false;
+    mWatchInvalid = true;
+    mSkippedUpdates = 0;
     mAlignment = ofxDatGuiAlignment::LEFT;
     mAlpha = 1.0f;
     mWidth = ofxDatGuiComponent::getTheme()->layout.width;
@@ -75,11 +94,14 @@ void ofxDatGui::init()
     mGuiBackground = ofxDatGuiComponent::getTheme()->color.guiBackground;
     
 // disable autodraw by default //
-    setAutoDraw(false, mGuis.size());
+    mAutoDraw = false;
+    mPriority = 0;
+    mCulled = false;
+    mCellRange.indexed = false;
     
-// assign focus to this newly created gui //
+// assign focus to this newly created gui & place it on top of the others //
     mActiveGui = this;
-    mGuis.push_back(this);
+    mZ = mCompositor.add(this);
     ofAddListener(ofEvents().windowResized, this, &ofxDatGui::onWindowResized, OF_EVENT_ORDER_BEFORE_APP);
 }
 
@@ -94,25 +116,46 @@ void ofxDatGui::focus()
         mVisible = true;
         mEnabled = true;
         mActiveGui = this;
-    // update the draw order //
-        for (int i=0; i<mGuis.size(); i++) {
-            if (mGuis[i] == mActiveGui) {
-                std::swap(mGuis[i], mGuis[mGuis.size()-1]);
-                break;
-            }
-        }
-        for (int i=0; i<mGuis.size(); i++) {
-            if (mGuis[i]->getAutoDraw()) mGuis[i]->setAutoDraw(true, i);
-        }
+    // move to the top of the draw order //
+        mCompositor.raise(mZ);
+        wake();
+    }
+}
+
+/*
+    a sleeping panel wakes as soon as it has focus, so sleep() only takes effect on panels
+    that aren't the focused one, putting the focused panel to sleep is undone by its next update
+*/
+
+void ofxDatGui::sleep()
+{
+    mSleeping = true;
+// collect the bound components that are still polled while asleep //
+    if (mWatchInvalid){
+        mWatched.clear();
+        for (int i=0; i<items.size(); i++) watch(items[i]);
+        mWatchInvalid = false;
     }
 }
 
+void ofxDatGui::wake()
+{
+    mSleeping = false;
+}
+
+void ofxDatGui::watch(ofxDatGuiComponent* c)
+{
+    if (c->getBound()) mWatched.push_back(c);
+    for (int i=0; i<c->children.size(); i++) watch(c->children[i]);
+}
+
 void ofxDatGui::expand()
 {
     if (mGuiFooter != nullptr){
         mExpanded = true;
+        mCacheInvalid = true;
         mGuiFooter->setExpanded(mExpanded);
-        mGuiFooter->setPosition(mPosition.x, mPosition.y + mHeight - mGuiFooter->getHeight() - mRowSpacing);
+        mGuiFooter->setPosition(mLayoutOrigin.x, mLayoutOrigin.y + mHeight - mGuiFooter->getHeight() - mRowSpacing);
     }
 }
 
@@ -120,8 +163,9 @@ void ofxDatGui::collapse()
 {
     if (mGuiFooter != nullptr){
         mExpanded = false;
+        mCacheInvalid = true;
         mGuiFooter->setExpanded(mExpanded);
-        mGuiFooter->setPosition(mPosition.x, mPosition.y);
+        mGuiFooter->setPosition(mLayoutOrigin.x, mLayoutOrigin.y);
     }
 }
 
@@ -159,6 +203,7 @@ void ofxDatGui::setTheme(ofxDatGuiTheme* t, bool applyImmediately)
     }
     mRowSpacing = t->layout.vMargin;
     mGuiBackground = t->color.guiBackground;
+    mCacheInvalid = true;
     setWidth(t->layout.width, t->layout.labelWidth);
 }
 
@@ -166,11 +211,13 @@ void ofxDatGui::setOpacity(float opacity)
 {
     mAlpha = opacity;
     mAlphaChanged = true;
+    mCacheInvalid = true;
 }
 
 void ofxDatGui::setPosition(int x, int y)
 {
     moveGui(ofPoint(x, y));
+    layoutGui();
 }
 
 void ofxDatGui::setPosition(ofxDatGuiAnchor anchor)
@@ -191,14 +238,10 @@ void ofxDatGui::setEnabled(bool enabled)
 
 void ofxDatGui::setAutoDraw(bool autodraw, int priority)
 {
+// guis with a higher priority are drawn above & picked before those with a lower one //
+    if (mAutoDraw != autodraw) mCompositor.setAutoDraw(autodraw);
     mAutoDraw = autodraw;
-    ofRemoveListener(ofEvents().draw, this, &ofxDatGui::onDraw, OF_EVENT_ORDER_AFTER_APP + mIndex);
-    ofRemoveListener(ofEvents().update, this, &ofxDatGui::onUpdate, OF_EVENT_ORDER_BEFORE_APP - mIndex);
-    if (mAutoDraw){
-        mIndex = priority;
-        ofAddListener(ofEvents().draw, this, &ofxDatGui::onDraw, OF_EVENT_ORDER_AFTER_APP + mIndex);
-        ofAddListener(ofEvents().update, this, &ofxDatGui::onUpdate, OF_EVENT_ORDER_BEFORE_APP - mIndex);
-    }
+    mPriority = priority;
 }
 
 bool ofxDatGui::getAutoDraw()
@@ -206,6 +249,112 @@ bool ofxDatGui::getAutoDraw()
     return mAutoDraw;
 }
 
+void ofxDatGui::setBatchRendering(bool batch)
+{
+    mBatchRendering = batch;
+}
+
+bool ofxDatGui::getBatchRendering()
+{
+    return mBatchRendering;
+}
+
+void ofxDatGui::setRetainedMode(bool retained)
+{
+    mRetainedMode = retained;
+    mCacheInvalid = true;
+}
+
+bool ofxDatGui::getRetainedMode()
+{
+    return mRetainedMode;
+}
+
+/*
+    level of detail, below the reduced zoom components draw as flat bars without text or inputs,
+    below the minimal zoom the whole panel is drawn as a single rectangle
+*/
+
+void ofxDatGui::setDetailThresholds(float reduced, float minimal)
+{
+    mReducedZoom = reduced;
+    mMinimalZoom = minimal;
+}
+
+ofxDatGuiDetail ofxDatGui::getDetail()
+{
+    if (zoom < mMinimalZoom){
+        return ofxDatGuiDetail::MINIMAL;
+    }   else if (zoom < mReducedZoom){
+        return ofxDatGuiDetail::REDUCED;
+    }   else{
+        return ofxDatGuiDetail::FULL;
+    }
+}
+
+/*
+    the viewport is the visible area of the screen, panels & components whose bounds
+    fall outside of it after translation & zoom are not drawn. an empty viewport disables culling.
+*/
+
+void ofxDatGui::setViewport(ofRectangle viewport)
+{
+    mViewport = viewport;
+}
+
+ofRectangle ofxDatGui::getViewport()
+{
+    return mViewport;
+}
+
+void ofxDatGui::setAutoSleep(bool autoSleep)
+{
+    mAutoSleep = autoSleep;
+    if (mAutoSleep == false) wake();
+}
+
+bool ofxDatGui::getSleeping()
+{
+    return mSleeping;
+}
+
+int ofxDatGui::getSkippedUpdates()
+{
+    return mSkippedUpdates;
+}
+
+void ofxDatGui::resetSkippedUpdates()
+{
+    mSkippedUpdates = 0;
+}
+
+ofxDatGuiCullStats ofxDatGui::getCullStats()
+{
+    return mCullStats;
+}
+
+void ofxDatGui::setEventDriven(bool eventDriven)
+{
+    if (mEventDriven != eventDriven) mCompositor.setEventDriven(eventDriven);
+    mEventDriven = eventDriven;
+}
+
+bool ofxDatGui::getEventDriven()
+{
+    return mEventDriven;
+}
+
+bool ofxDatGui::getCulled(ofRectangle bounds)
+{
+    if (mViewport.width <= 0 || mViewport.height <= 0) return false;
+// map the bounds from canvas space to screen space //
+    bounds.x = bounds.x * zoom + translationX;
+    bounds.y = bounds.y * zoom + translationY;
+    bounds.width *= zoom;
+    bounds.height *= zoom;
+    return mViewport.intersects(bounds) == false;
+}
+
 bool ofxDatGui::getMouseDown()
 {
     return mMouseDown;
@@ -765,6 +914,10 @@ void ofxDatGui::onInternalEventCallback(ofxDatGuiInternalEvent e)
         mExpanded ? collapse() : expand();
     }   else if (e.type == ofxDatGuiEventType::VISIBILITY_CHANGED){
         layoutGui();
+    }   else if (e.type == ofxDatGuiEventType::PANEL_WAKE){
+    // a component may have just been bound so rebuild the watch list before sleeping again //
+        mWatchInvalid = true;
+        wake();
     }
 }
 
@@ -781,12 +934,78 @@ bool ofxDatGui::hitTest(ofPoint pt)
     }
 }
 
+void ofxDatGui::focusAt(ofPoint pointer)
+{
+    if (mActiveGui->mMoving) return;
+    ofPoint mouse = ofPoint((pointer.x - translationX)/zoom, (pointer.y - translationY)/zoom);
+    ofxDatGui* gui = mCompositor.pick(mouse);
+    if (gui != nullptr && gui != mActiveGui) gui->focus();
+}
+
+void ofxDatGui::dispatch(ofPoint pointer, bool pressed)
+{
+    if (!mVisible || !mEnabled) return;
+    mMoving = false;
+    mMouseDown = false;
+    if (mExpanded == false){
+        mGuiFooter->dispatch(pointer, pressed);
+        mMouseDown = mGuiFooter->getMouseDown();
+        return;
+    }
+// only the row under the pointer & rows still hovered, pressed or focused can react //
+    ofPoint mouse = ofPoint((pointer.x - translationX)/zoom, (pointer.y - translationY)/zoom);
+    mTargets.clear();
+    for (auto item:mEngaged) if (item->getEngaged()) mTargets.push_back(item);
+    ofxDatGuiComponent* row = getRow(mouse - (mPosition - mLayoutOrigin));
+    if (row != nullptr && std::find(mTargets.begin(), mTargets.end(), row) == mTargets.end()) mTargets.push_back(row);
+    std::sort(mTargets.begin(), mTargets.end(), [](ofxDatGuiComponent* a, ofxDatGuiComponent* b){ return a->getIndex() < b->getIndex(); });
+// the first component that takes focus owns the event, the rest only drop their focus //
+    bool hitComponent = false;
+    for (auto item:mTargets) {
+        if (hitComponent == false){
+            item->dispatch(pointer, pressed);
+            if (item->getFocused()){
+                hitComponent = true;
+                mMouseDown = item->getMouseDown();
+                if (mGuiHeader != nullptr && mGuiHeader->getDraggable() && mGuiHeader->getFocused()){
+                    mMoving = true;
+                    moveGui(mouse - mGuiHeader->getDragOffset());
+                }
+            }
+        }   else if (item->getFocused()){
+            item->setFocused(false);
+        }
+    }
+    mEngaged.clear();
+    for (auto item:mTargets) if (item->getEngaged()) mEngaged.push_back(item);
+}
+
+// components keep their layout positions while the panel is dragged, the offset is applied when drawing //
 void ofxDatGui::moveGui(ofPoint pt)
 {
     mPosition.x = pt.x;
     mPosition.y = pt.y;
     mAnchor = ofxDatGuiAnchor::NO_ANCHOR;
-    layoutGui();
+    mGuiBounds.setPosition(mPosition.x, mPosition.y);
+    mCompositor.index(this);
+}
+
+// pushes the panel offset into the transform the components hit test through, only when it changes //
+void ofxDatGui::translateItems()
+{
+    ofPoint offset = mPosition - mLayoutOrigin;
+    float tx = translationX + offset.x * zoom;
+    float ty = translationY + offset.y * zoom;
+    if (mItemsTranslated && tx == mItemTX && ty == mItemTY && zoom == mItemZoom && offset == mItemOffset) return;
+    for (int i=0; i<items.size(); i++) {
+        items[i]->setTranslation(tx, ty, zoom);
+        items[i]->setPanelOffset(offset);
+    }
+    mItemsTranslated = true;
+    mItemTX = tx;
+    mItemTY = ty;
+    mItemZoom = zoom;
+    mItemOffset = offset;
 }
 
 void ofxDatGui::anchorGui()
@@ -828,6 +1047,31 @@ void ofxDatGui::layoutGui()
     // move the footer back to the top of the gui //
     if (!mExpanded) mGuiFooter->setPosition(mPosition.x, mPosition.y);
     mGuiBounds = ofRectangle(mPosition.x, mPosition.y, mWidth, mHeight);
+    mLayoutOrigin = mPosition;
+    mCacheInvalid = true;
+    mCompositor.index(this);
+    indexRows();
+}
+
+void ofxDatGui::indexRows()
+{
+    mWatchInvalid = true;
+    mItemsTranslated = false;
+    mRows.clear();
+    for (int i=0; i<items.size(); i++) if (items[i]->getVisible()) mRows.push_back(items[i]);
+    std::stable_sort(mRows.begin(), mRows.end(), [](ofxDatGuiComponent* a, ofxDatGuiComponent* b){ return a->getY() < b->getY(); });
+// forget engaged rows that were removed from the gui //
+    for (int i=mEngaged.size()-1; i>-1; i--){
+        if (std::find(items.begin(), items.end(), mEngaged[i]) == items.end()) mEngaged.erase(mEngaged.begin() + i);
+    }
+}
+
+ofxDatGuiComponent* ofxDatGui::getRow(ofPoint pt)
+{
+    auto row = std::upper_bound(mRows.begin(), mRows.end(), pt.y, [](float y, ofxDatGuiComponent* c){ return y < c->getY(); });
+    if (row == mRows.begin()) return nullptr;
+    row--;
+    return pt.y <= (*row)->getY() + (*row)->getHeight() ? *row : nullptr;
 }
 
 /* 
@@ -854,23 +1098,30 @@ void ofxDatGui::update()
     mThemeChanged = false;
     mAlignmentChanged = false;
     
-    // check for gui focus change //
-    if (ofGetMousePressed() && mActiveGui->mMoving == false){
-        ofPoint mouse = ofPoint(ofGetMouseX(), ofGetMouseY());
-        mouse.x = (mouse.x - translationX)/zoom;
-        mouse.y = (mouse.y - translationY)/zoom;
-        for (int i=mGuis.size()-1; i>-1; i--){
-        // ignore guis that are invisible //
-            if (mGuis[i]->getVisible() && mGuis[i]->hitTest(mouse)){
-                if (mGuis[i] != mActiveGui) mGuis[i]->focus();
-                break;
-            }
+    // check for gui focus change, event driven guis do this as the pointer events arrive //
+    bool polling = mEventDriven == false;
+    if (polling && ofGetMousePressed()) focusAt(ofPoint(ofGetMouseX(), ofGetMouseY()));
+    
+    // a sleeping panel skips its per-frame work until it takes focus or a bound variable changes //
+    if (mSleeping){
+        if (getFocused() == false && getStale() == false){
+            mSkippedUpdates++;
+        // components removed while asleep are still deleted //
+            emptyTrash();
+            return;
         }
+        wake();
     }
 
+// only this panel's components skip polling, standalone components keep hit-testing in their own update //
+    ofxDatGuiComponent::mEventDriven = mEventDriven;
     if (!getFocused() || !mEnabled){
     // update children but ignore mouse & keyboard events //
         for (int i=0; i<items.size(); i++) items[i]->update(false);
+    }   else if (polling == false){
+    // components only do their per-frame work, input was already routed by dispatch //
+        for (int i=0; i<items.size(); i++) items[i]->update(true);
+        if (mExpanded == false) mGuiFooter->update();
     }   else {
         mMoving = false;
         mMouseDown = false;
@@ -914,40 +1165,153 @@ void ofxDatGui::update()
             }
         }
     }
-// empty the trash //
+    ofxDatGuiComponent::mEventDriven = false;
+// lay the components out at the new position once the panel is no longer being dragged //
+    if (mMoving == false && mPosition != mLayoutOrigin) layoutGui();
+    emptyTrash();
+    if (mAutoSleep && !getFocused()) sleep();
+}
+
+void ofxDatGui::emptyTrash()
+{
     for (int i=0; i<trash.size(); i++) delete trash[i];
     trash.clear();
 }
 
+bool ofxDatGui::getStale()
+{
+    for (int i=0; i<mWatched.size(); i++) if (mWatched[i]->getStale()) return true;
+    return false;
+}
+
 void ofxDatGui::draw()
 {
     if (mVisible == false) return;
-    ofPushStyle();
+    drawBody();
+    drawOverlays();
+}
 
-        ofFill();
-        ofSetColor(mGuiBackground, mAlpha * 255);
-        if (mExpanded == false){
-            ofDrawRectangle(mPosition.x, mPosition.y, mWidth, mGuiFooter->getHeight());
-            mGuiFooter->draw();
+void ofxDatGui::drawBody()
+{
+    if (mCullFrame != ofGetFrameNum()){
+        mCullFrame = ofGetFrameNum();
+        mCullStats = ofxDatGuiCullStats();
+    }
+    mCulled = getCulled(mGuiBounds);
+    if (mCulled){
+        mCullStats.panelsCulled++;
+        return;
+    }
+    mCullStats.panelsDrawn++;
+    ofxDatGuiDetail detail = getDetail();
+    translateItems();
+    ofxDatGuiComponent::mPanelDrawing = true;
+    ofPushStyle();
+    ofPushMatrix();
+    ofTranslate(mItemOffset.x, mItemOffset.y);
+        if (detail == ofxDatGuiDetail::MINIMAL){
+            int height = mExpanded ? mHeight - mRowSpacing : mGuiFooter->getHeight();
+            ofxDatGuiBatch::rect(mLayoutOrigin.x, mLayoutOrigin.y, mWidth, height, ofColor(mGuiBackground, mAlpha * 255));
+        }   else if (detail == ofxDatGuiDetail::REDUCED){
+            drawPanel(detail);
+        }   else if (mRetainedMode){
+            ofxDatGuiRenderer::getRenderer()->custom("panel.cache", ofRectangle(mLayoutOrigin.x, mLayoutOrigin.y, mWidth, mHeight), [&](){
+            // only re-render the panel when one of its components or the zoom has changed //
+                if (mCacheInvalid || mCacheZoom != zoom || getDirty()) renderCache();
+            // the cache holds premultiplied colors so it's composited without scaling by alpha again //
+                ofEnableBlendMode(OF_BLENDMODE_DISABLED);
+                glEnable(GL_BLEND);
+                glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+                ofSetColor(ofColor::white);
+                mCache.draw(mLayoutOrigin.x, mLayoutOrigin.y, mWidth, mHeight);
+                ofEnableBlendMode(OF_BLENDMODE_ALPHA);
+            });
         }   else{
-            ofDrawRectangle(mPosition.x, mPosition.y, mWidth, mHeight - mRowSpacing);
-            //for (int i=0; i<items.size(); i++) items[i]->draw();
-            for (int i=0; i<items.size(); i++) items[i]->drawTranslated(translationX, translationY, zoom);
-        // color pickers overlap other components when expanded so they must be drawn last //
-            for (int i=0; i<items.size(); i++) items[i]->drawColorPicker();
+            drawPanel();
         }
-
+    ofPopMatrix();
     ofPopStyle();
+    ofxDatGuiComponent::mPanelDrawing = false;
 }
 
-void ofxDatGui::onDraw(ofEventArgs &e)
+void ofxDatGui::drawOverlays()
 {
-    draw();
+// wires & color pickers overlap other components so they must be drawn last //
+    if (mExpanded == false || getDetail() != ofxDatGuiDetail::FULL) return;
+    translateItems();
+    ofPushStyle();
+    ofPushMatrix();
+    ofTranslate(mItemOffset.x, mItemOffset.y);
+    // wires can lead from an off-screen panel into the viewport so they're drawn even when the panel is culled //
+        for (int i=0; i<items.size(); i++) items[i]->drawWireConnections();
+        if (mCulled == false) for (int i=0; i<items.size(); i++) items[i]->drawColorPicker();
+    ofPopMatrix();
+    ofPopStyle();
 }
 
-void ofxDatGui::onUpdate(ofEventArgs &e)
+void ofxDatGui::drawPanel(ofxDatGuiDetail detail)
 {
-    update();
+// collect the panel's solid quads into a single mesh unless the compositor is already batching several panels //
+    bool batch = mBatchRendering && ofxDatGuiBatch::isActive() == false;
+    if (batch) mCompositor.getBatch().begin();
+    ofColor bkgd(mGuiBackground, mAlpha * 255);
+    if (mExpanded == false){
+        ofxDatGuiBatch::rect(mLayoutOrigin.x, mLayoutOrigin.y, mWidth, mGuiFooter->getHeight(), bkgd);
+        if (detail == ofxDatGuiDetail::FULL){
+            mGuiFooter->draw();
+        }   else{
+            mGuiFooter->drawReduced();
+        }
+    }   else{
+        ofxDatGuiBatch::rect(mLayoutOrigin.x, mLayoutOrigin.y, mWidth, mHeight - mRowSpacing, bkgd);
+    // the retained cache must hold every component so only cull when drawing directly //
+        for (int i=0; i<items.size(); i++) {
+            if (mRetainedMode == false && getCulled(ofRectangle(items[i]->getX() + mItemOffset.x, items[i]->getY() + mItemOffset.y, items[i]->getWidth(), items[i]->getHeight()))){
+                mCullStats.componentsCulled++;
+            }   else{
+                mCullStats.componentsDrawn++;
+                if (detail == ofxDatGuiDetail::FULL){
+                    items[i]->drawTranslated(mItemTX, mItemTY, zoom);
+                }   else{
+                    items[i]->drawReduced();
+                }
+            }
+        }
+    }
+    if (batch) mCompositor.getBatch().end();
+}
+
+void ofxDatGui::renderCache()
+{
+    if (mWidth <= 0 || mHeight <= 0 || zoom <= 0) return;
+// the cache is rendered at the zoomed size so it stays sharp when the app scales the panel //
+    int w = ceil(mWidth * zoom);
+    int h = ceil(mHeight * zoom);
+    if (mCache.getWidth() != w || mCache.getHeight() != h) mCache.allocate(w, h, GL_RGBA);
+// the cache has to hold this panel's own quads & text so it can't render into the compositor's batch //
+    bool shared = ofxDatGuiBatch::isActive();
+    if (shared) mCompositor.getBatch().end();
+    mCache.begin();
+        ofClear(0, 0, 0, 0);
+    // accumulate alpha separately so translucent themes end up premultiplied in the cache //
+        ofEnableBlendMode(OF_BLENDMODE_ALPHA);
+        glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+        ofPushMatrix();
+        ofScale(zoom, zoom);
+        ofTranslate(-mLayoutOrigin.x, -mLayoutOrigin.y);
+        drawPanel();
+        ofPopMatrix();
+    mCache.end();
+    if (shared) mCompositor.getBatch().begin();
+    for (int i=0; i<items.size(); i++) items[i]->setDirty(false);
+    mCacheInvalid = false;
+    mCacheZoom = zoom;
+}
+
+bool ofxDatGui::getDirty()
+{
+    for (int i=0; i<items.size(); i++) if (items[i]->getDirty()) return true;
+    return false;
 }
 
 void ofxDatGui::onWindowResized(ofResizeEventArgs &e)
@@ -992,6 +1356,8 @@ void ofxDatGui::resetMidiMap()
 void ofxDatGui::deleteItems()
 {
     items.clear();
+    indexRows();
+    mCacheInvalid = true;
 }
 
 vector<ofxDatGuiComponent*> ofxDatGui::getItems()
@@ -1001,29 +1367,8 @@ vector<ofxDatGuiComponent*> ofxDatGui::getItems()
 
 ofxDatGuiComponent * ofxDatGui::getInputComponent(int x, int y)
 {
-    ofPoint pos(-1, -1);
-    for (int i=0; i<items.size(); i++) {
-        ofxDatGuiComponent * item = items[i];
-        if(item->children.size() > 0)
-        {
-            for(int j=0; j<item->children.size(); j++)
-            {
-                if( item->children[j]->getInputSelected(x, y) != nullptr)
-                {
-                    return item->children[j]->getInputSelected(x, y);
-                }
-                
-            }
-        } else {
-            if(item->getInputSelected(x, y) != nullptr)
-            {
-                return item->getInputSelected(x, y);
-            }
-            
-        }
-    }
-    
-    return nullptr;
+    ofPoint offset = mPosition - mLayoutOrigin;
+    return ofxDatGuiWireIndex::nearest(ofxDatGuiWireIndex::INPUT, x - offset.x, y - offset.y, [this](ofxDatGuiComponent* c){ return owns(c); });
 }
 
 
@@ -1055,61 +1400,37 @@ ofxDatGuiComponent * ofxDatGui::getOutputComponent(int x, int y)
 
 DKWireConnection * ofxDatGui::testInputConnection(int x, int y)
 {
-    for (int i=0; i<items.size(); i++) {
-        ofxDatGuiComponent * item = items[i];
-        if(item->children.size() > 0)
-        {
-            for(int j=0; j<item->children.size(); j++)
-            {
-                if( item->children[j]->getInputConnection(x, y) != nullptr)
-                {
-                    return item->children[j]->inputConnection->testWireConnection(x, y);
-                }
-                
-            }
-        } else {
-            if(item->getInputConnection(x, y) != nullptr)
-            {
-                return item->inputConnection->testWireConnection(x, y);
-            }
-            
-        }
-    }
-    
-    return nullptr;
+    ofPoint offset = mPosition - mLayoutOrigin;
+    ofxDatGuiComponent* c = getInputComponent(x, y);
+    return c == nullptr ? nullptr : c->inputConnection->testWireConnection(x - offset.x, y - offset.y);
 }
 
 DKWireConnection * ofxDatGui::testOutputConnection(int x, int y)
+{
+    ofPoint offset = mPosition - mLayoutOrigin;
+    ofxDatGuiComponent* c = ofxDatGuiWireIndex::nearest(ofxDatGuiWireIndex::OUTPUT, x - offset.x, y - offset.y, [this](ofxDatGuiComponent* c){ return owns(c); });
+    return c == nullptr ? nullptr : c->outputConnection->testWireConnection(x - offset.x, y - offset.y);
+}
+
+// only runs once the index has found a connector near the pointer //
+bool ofxDatGui::owns(ofxDatGuiComponent* c)
 {
     for (int i=0; i<items.size(); i++) {
-        ofxDatGuiComponent * item = items[i];
-        if(item->children.size() > 0)
-        {
-            for(int j=0; j<item->children.size(); j++)
-            {
-                if( item->children[j]->getOutputConnection(x, y) != nullptr)
-                {
-                    return item->children[j]->outputConnection->testWireConnection(x, y);
-                }
-                
-            }
-        } else {
-            if(item->getOutputConnection(x, y) != nullptr)
-            {
-                return item->outputConnection->testWireConnection(x, y);
-            }
-            
+        if (items[i]->children.size() > 0){
+            for (int j=0; j<items[i]->children.size(); j++) if (items[i]->children[j] == c) return true;
+        }   else if (items[i] == c){
+            return true;
         }
     }
-    
-    return nullptr;
-    
+    return false;
 }
 
 void ofxDatGui::setItems(vector<ofxDatGuiComponent *> newItems)
 {
     items.clear();
     items = newItems;
+    indexRows();
+    mCacheInvalid = true;
 }
 
 void ofxDatGui::setTranslation(float x, float y, float zm)
@@ -1118,3 +1439,199 @@ void ofxDatGui::setTranslation(float x, float y, float zm)
     translationY = y;
 	zoom = zm;
 }
+
+/*
+    compositor
+*/
+
+list<ofxDatGui*>::iterator ofxDatGuiCompositor::add(ofxDatGui* gui)
+{
+    gui->mDepth = ++mDepth;
+    return mGuis.insert(mGuis.end(), gui);
+}
+
+void ofxDatGuiCompositor::remove(list<ofxDatGui*>::iterator z)
+{
+    mGuis.erase(z);
+}
+
+void ofxDatGuiCompositor::raise(list<ofxDatGui*>::iterator z)
+{
+// relinks the node in place so every other gui keeps its iterator //
+    mGuis.splice(mGuis.end(), mGuis, z);
+    (*z)->mDepth = ++mDepth;
+}
+
+void ofxDatGuiCompositor::setAutoDraw(bool autodraw)
+{
+    if (autodraw){
+        if (mAutoDrawCount++ == 0){
+            ofAddListener(ofEvents().draw, this, &ofxDatGuiCompositor::onDraw, OF_EVENT_ORDER_AFTER_APP);
+            ofAddListener(ofEvents().update, this, &ofxDatGuiCompositor::onUpdate, OF_EVENT_ORDER_BEFORE_APP);
+        }
+    }   else if (mAutoDrawCount > 0){
+        if (--mAutoDrawCount == 0){
+            ofRemoveListener(ofEvents().draw, this, &ofxDatGuiCompositor::onDraw, OF_EVENT_ORDER_AFTER_APP);
+            ofRemoveListener(ofEvents().update, this, &ofxDatGuiCompositor::onUpdate, OF_EVENT_ORDER_BEFORE_APP);
+        }
+    }
+}
+
+const list<ofxDatGui*>& ofxDatGuiCompositor::getGuis()
+{
+    return mGuis;
+}
+
+ofxDatGuiBatch& ofxDatGuiCompositor::getBatch()
+{
+    return mBatch;
+}
+
+void ofxDatGuiCompositor::onDraw(ofEventArgs &e)
+{
+// bottom to top so the focused gui is drawn last //
+    mPass.assign(mGuis.begin(), mGuis.end());
+    std::stable_sort(mPass.begin(), mPass.end(), below);
+    for (auto gui:mPass){
+        if (gui->getAutoDraw() == false || gui->getVisible() == false) continue;
+    // panels share one batch until one overlaps a panel already in it, batched text is only drawn when the batch ends //
+        bool isolated = gui->mBatchRendering == false || gui->mPosition != gui->mLayoutOrigin;
+        bool overlaps = false;
+        for (auto b:mBatched) if (b->mGuiBounds.intersects(gui->mGuiBounds)) overlaps = true;
+        if (isolated || overlaps) submit();
+        if (isolated){
+        // unbatched or dragged panels draw on their own, a dragged panel is translated & can't share vertices //
+            gui->draw();
+        }   else{
+            if (mBatched.empty()) mBatch.begin();
+            gui->drawBody();
+            mBatched.push_back(gui);
+        }
+    }
+    submit();
+}
+
+void ofxDatGuiCompositor::submit()
+{
+    mBatch.end();
+    for (auto gui:mBatched) gui->drawOverlays();
+    mBatched.clear();
+}
+
+bool ofxDatGuiCompositor::below(ofxDatGui* a, ofxDatGui* b)
+{
+    if (a->mPriority != b->mPriority) return a->mPriority < b->mPriority;
+    return a->mDepth < b->mDepth;
+}
+
+void ofxDatGuiCompositor::onUpdate(ofEventArgs &e)
+{
+// top to bottom, iterating a snapshot since a gui can take focus while updating //
+    mPass.assign(mGuis.begin(), mGuis.end());
+    std::stable_sort(mPass.begin(), mPass.end(), below);
+    std::reverse(mPass.begin(), mPass.end());
+    for (auto gui:mPass) if (gui->getAutoDraw()) gui->update();
+}
+
+void ofxDatGuiCompositor::setEventDriven(bool eventDriven)
+{
+// the mouse listeners stay registered while at least one panel is event driven //
+    if (eventDriven){
+        if (mEventDrivenCount++ > 0) return;
+        ofAddListener(ofEvents().mouseMoved, this, &ofxDatGuiCompositor::onMouseMoved, OF_EVENT_ORDER_BEFORE_APP);
+        ofAddListener(ofEvents().mousePressed, this, &ofxDatGuiCompositor::onMousePressed, OF_EVENT_ORDER_BEFORE_APP);
+        ofAddListener(ofEvents().mouseDragged, this, &ofxDatGuiCompositor::onMouseDragged, OF_EVENT_ORDER_BEFORE_APP);
+        ofAddListener(ofEvents().mouseReleased, this, &ofxDatGuiCompositor::onMouseReleased, OF_EVENT_ORDER_BEFORE_APP);
+        ofAddListener(ofEvents().mouseScrolled, this, &ofxDatGuiCompositor::onMouseScrolled, OF_EVENT_ORDER_BEFORE_APP);
+    }   else if (mEventDrivenCount > 0){
+        if (--mEventDrivenCount > 0) return;
+        ofRemoveListener(ofEvents().mouseMoved, this, &ofxDatGuiCompositor::onMouseMoved, OF_EVENT_ORDER_BEFORE_APP);
+        ofRemoveListener(ofEvents().mousePressed, this, &ofxDatGuiCompositor::onMousePressed, OF_EVENT_ORDER_BEFORE_APP);
+        ofRemoveListener(ofEvents().mouseDragged, this, &ofxDatGuiCompositor::onMouseDragged, OF_EVENT_ORDER_BEFORE_APP);
+        ofRemoveListener(ofEvents().mouseReleased, this, &ofxDatGuiCompositor::onMouseReleased, OF_EVENT_ORDER_BEFORE_APP);
+        ofRemoveListener(ofEvents().mouseScrolled, this, &ofxDatGuiCompositor::onMouseScrolled, OF_EVENT_ORDER_BEFORE_APP);
+    }
+}
+
+void ofxDatGuiCompositor::onMouseMoved(ofMouseEventArgs &e)
+{
+    route(ofPoint(e.x, e.y), false);
+}
+
+void ofxDatGuiCompositor::onMousePressed(ofMouseEventArgs &e)
+{
+    route(ofPoint(e.x, e.y), true);
+}
+
+void ofxDatGuiCompositor::onMouseDragged(ofMouseEventArgs &e)
+{
+    route(ofPoint(e.x, e.y), true);
+}
+
+void ofxDatGuiCompositor::onMouseReleased(ofMouseEventArgs &e)
+{
+    route(ofPoint(e.x, e.y), false);
+}
+
+void ofxDatGuiCompositor::onMouseScrolled(ofMouseEventArgs &e)
+{
+// scrolling can move content under a still pointer so refresh hover with the current button state //
+    route(ofPoint(e.x, e.y), mPressed);
+}
+
+void ofxDatGuiCompositor::route(ofPoint pointer, bool pressed)
+{
+    mPressed = pressed;
+    if (ofxDatGui::mActiveGui == nullptr) return;
+    if (pressed) ofxDatGui::mActiveGui->focusAt(pointer);
+// only the focused gui receives input, matching the polling behavior, and only if it isn't polling itself //
+    if (ofxDatGui::mActiveGui->mEventDriven) ofxDatGui::mActiveGui->dispatch(pointer, pressed);
+}
+
+uint64_t ofxDatGuiCompositor::getCellKey(int cx, int cy)
+{
+    return ((uint64_t)(uint32_t)cx << 32) | (uint32_t)cy;
+}
+
+void ofxDatGuiCompositor::index(ofxDatGui* gui)
+{
+    const ofRectangle& b = gui->mGuiBounds;
+    int x1 = floor(b.getLeft() / CellSize);
+    int y1 = floor(b.getTop() / CellSize);
+    int x2 = floor(b.getRight() / CellSize);
+    int y2 = floor(b.getBottom() / CellSize);
+// most relayouts don't move a panel across a cell boundary //
+    if (gui->mCellRange.indexed && gui->mCellRange.x1 == x1 && gui->mCellRange.y1 == y1
+        && gui->mCellRange.x2 == x2 && gui->mCellRange.y2 == y2) return;
+    unindex(gui);
+    for (int cx=x1; cx<=x2; cx++){
+        for (int cy=y1; cy<=y2; cy++) mCells[getCellKey(cx, cy)].push_back(gui);
+    }
+    gui->mCellRange = {x1, y1, x2, y2, true};
+}
+
+void ofxDatGuiCompositor::unindex(ofxDatGui* gui)
+{
+    if (gui->mCellRange.indexed == false) return;
+    for (int cx=gui->mCellRange.x1; cx<=gui->mCellRange.x2; cx++){
+        for (int cy=gui->mCellRange.y1; cy<=gui->mCellRange.y2; cy++){
+            auto cell = mCells.find(getCellKey(cx, cy));
+            if (cell == mCells.end()) continue;
+            cell->second.erase(std::remove(cell->second.begin(), cell->second.end(), gui), cell->second.end());
+            if (cell->second.empty()) mCells.erase(cell);
+        }
+    }
+    gui->mCellRange.indexed = false;
+}
+
+ofxDatGui* ofxDatGuiCompositor::pick(ofPoint pt)
+{
+// the panel highest in the z-order wins when several overlap the point //
+    auto cell = mCells.find(getCellKey(floor(pt.x / CellSize), floor(pt.y / CellSize)));
+    if (cell == mCells.end()) return nullptr;
+    ofxDatGui* top = nullptr;
+    for (auto gui:cell->second){
+        if (gui->getVisible() && gui->hitTest(pt) && (top == nullptr || below(top, gui))) top = gui;
+    }
+    return top;
+}
@@ -25,6 +25,63 @@
 #include "ofxDatGuiControls.h"
 #include "DKWireConnection.hpp"
 
+// number of panels & components drawn or skipped by viewport culling during the current frame //
+struct ofxDatGuiCullStats {
+    int panelsDrawn = 0;
+    int panelsCulled = 0;
+    int componentsDrawn = 0;
+    int componentsCulled = 0;
+};
+
+class ofxDatGui;
+
+/*
+    owns the z-order of every gui panel and draws & updates the autodraw panels
+    from a single pair of event listeners, bottom to top through one shared batch
+*/
+class ofxDatGuiCompositor {
+
+    public:
+    
+        list<ofxDatGui*>::iterator add(ofxDatGui* gui);
+        void index(ofxDatGui* gui);
+        void unindex(ofxDatGui* gui);
+        ofxDatGui* pick(ofPoint pt);
+        void remove(list<ofxDatGui*>::iterator z);
+        void raise(list<ofxDatGui*>::iterator z);
+        void setAutoDraw(bool autodraw);
+        void setEventDriven(bool eventDriven);
+        const list<ofxDatGui*>& getGuis();
+        ofxDatGuiBatch& getBatch();
+    
+    private:
+    
+        int mAutoDrawCount = 0;
+        int mEventDrivenCount = 0;
+        uint64_t mDepth = 0;
+        bool mPressed = false;
+        list<ofxDatGui*> mGuis;
+        vector<ofxDatGui*> mPass;
+        vector<ofxDatGui*> mBatched;
+    // uniform grid of panel bounds keyed by packed cell coordinates //
+        static const int CellSize = 256;
+        unordered_map<uint64_t, vector<ofxDatGui*>> mCells;
+        uint64_t getCellKey(int cx, int cy);
+        ofxDatGuiBatch mBatch;
+    
+        void onDraw(ofEventArgs &e);
+        void onUpdate(ofEventArgs &e);
+        void onMouseMoved(ofMouseEventArgs &e);
+        void onMousePressed(ofMouseEventArgs &e);
+        void onMouseDragged(ofMouseEventArgs &e);
+        void onMouseReleased(ofMouseEventArgs &e);
+        void onMouseScrolled(ofMouseEventArgs &e);
+        void route(ofPoint pointer, bool pressed);
+        void submit();
+        static bool below(ofxDatGui* a, ofxDatGui* b);
+
+};
+
 class ofxDatGui : public ofxDatGuiInteractiveObject
 {
     
@@ -37,6 +94,8 @@ class ofxDatGui : public ofxDatGuiInteractiveObject
         void draw();
         void update();
         void focus();
+        void sleep();
+        void wake();
         void expand();
         void toggle();
         void collapse();
@@ -49,10 +108,22 @@ class ofxDatGui : public ofxDatGuiInteractiveObject
         void setPosition(ofxDatGuiAnchor anchor);
         void setTheme(ofxDatGuiTheme* t, bool applyImmediately = false);
         void setAutoDraw(bool autodraw, int priority = 0);
+        void setBatchRendering(bool batch);
+        void setRetainedMode(bool retained);
         void setLabelAlignment(ofxDatGuiAlignment align);
         void setTranslation(float, float, float);
+        void setDetailThresholds(float reduced, float minimal);
+        void setAutoSleep(bool autoSleep);
+        bool getSleeping();
+        int getSkippedUpdates();
+        void resetSkippedUpdates();
         static void setAssetPath(string path);
         static string getAssetPath();
+        static void setViewport(ofRectangle viewport);
+        static ofRectangle getViewport();
+        static ofxDatGuiCullStats getCullStats();
+        void setEventDriven(bool eventDriven);
+        bool getEventDriven();
     
         void setItems(vector<ofxDatGuiComponent*>);
     
@@ -71,6 +142,9 @@ class ofxDatGui : public ofxDatGuiInteractiveObject
         bool getFocused();
         bool getVisible();
         bool getAutoDraw();
+        bool getBatchRendering();
+        bool getRetainedMode();
+        ofxDatGuiDetail getDetail();
         bool getMouseDown();
         bool getEnabled();
         ofPoint getPosition();
@@ -115,7 +189,6 @@ class ofxDatGui : public ofxDatGuiInteractiveObject
 		
     private:
     
-        int mIndex;
         int mWidth;
         int mHeight;
         int mRowSpacing;
@@ -126,6 +199,15 @@ class ofxDatGui : public ofxDatGuiInteractiveObject
         bool mEnabled;
         bool mExpanded;
         bool mAutoDraw;
+        bool mBatchRendering;
+        bool mRetainedMode;
+        bool mCacheInvalid;
+        float mCacheZoom;
+        bool mSleeping;
+        bool mAutoSleep;
+        bool mEventDriven;
+        bool mWatchInvalid;
+        int mSkippedUpdates;
         bool mMouseDown;
         bool mAlphaChanged;
         bool mWidthChanged;
@@ -135,32 +217,74 @@ class ofxDatGui : public ofxDatGuiInteractiveObject
         float translationY;
 		float translationX;
 		float zoom;
+        float mReducedZoom;
+        float mMinimalZoom;
     
     
         ofColor mGuiBackground;
     
         ofPoint mPosition;
+    // where the components were last laid out, the panel is drawn offset from here while dragged //
+        ofPoint mLayoutOrigin;
+        ofPoint mItemOffset;
+        float mItemTX;
+        float mItemTY;
+        float mItemZoom;
+        bool mItemsTranslated;
         ofRectangle mGuiBounds;
         ofxDatGuiAnchor mAnchor;
         ofxDatGuiHeader* mGuiHeader;
         ofxDatGuiFooter* mGuiFooter;
         ofxDatGuiTheme* mTheme;
         ofxDatGuiAlignment mAlignment;
+        ofFbo mCache;
         vector<ofxDatGuiComponent*> items;
         vector<ofxDatGuiComponent*> trash;
         static ofxDatGui* mActiveGui;
-        static vector<ofxDatGui*> mGuis;
+        list<ofxDatGui*>::iterator mZ;
+        uint64_t mDepth;
+        int mPriority;
+        bool mCulled;
+        struct{
+            int x1;
+            int y1;
+            int x2;
+            int y2;
+            bool indexed;
+        } mCellRange;
+        vector<ofxDatGuiComponent*> mRows;
+        vector<ofxDatGuiComponent*> mEngaged;
+        vector<ofxDatGuiComponent*> mTargets;
+        vector<ofxDatGuiComponent*> mWatched;
+        static ofxDatGuiCompositor mCompositor;
+        friend class ofxDatGuiCompositor;
         static unique_ptr<ofxDatGuiTheme> theme;
+        static ofRectangle mViewport;
+        static ofxDatGuiCullStats mCullStats;
+        static uint64_t mCullFrame;
     
         void init();
         void layoutGui();
+        void indexRows();
+        ofxDatGuiComponent* getRow(ofPoint pt);
+        void drawBody();
+        void drawOverlays();
+        void drawPanel(ofxDatGuiDetail detail = ofxDatGuiDetail::FULL);
+        void renderCache();
+        bool getDirty();
+        bool getStale();
+        void emptyTrash();
+        void watch(ofxDatGuiComponent* c);
+        bool getCulled(ofRectangle bounds);
         void anchorGui();
         void moveGui(ofPoint pt);
+        void translateItems();
         bool hitTest(ofPoint pt);
+        bool owns(ofxDatGuiComponent* c);
+        void focusAt(ofPoint pointer);
+        void dispatch(ofPoint pointer, bool pressed);
         void attachItem(ofxDatGuiComponent* item);
     
-        void onDraw(ofEventArgs &e);
-        void onUpdate(ofEventArgs &e);
         void onWindowResized(ofResizeEventArgs &e);
     
         ofxDatGuiComponent* getComponent(string key);